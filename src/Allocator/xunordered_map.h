@@ -0,0 +1,17 @@
+#ifndef _XUNORDERED_MAP_H
+#define _XUNORDERED_MAP_H
+
+#include "stl_allocator.h"
+#include <unordered_map>
+#include <functional>
+
+// xunordered_map uses a fix-block memory allocator
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+	typename Alloc = stl_allocator<std::pair<const Key, Value>>>
+using xunordered_map = std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>;
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+	typename Alloc = stl_allocator<std::pair<const Key, Value>>>
+using xunordered_multimap = std::unordered_multimap<Key, Value, Hash, KeyEqual, Alloc>;
+
+#endif
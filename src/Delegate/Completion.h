@@ -0,0 +1,225 @@
+#ifndef _DELEGATELIB_COMPLETION_H
+#define _DELEGATELIB_COMPLETION_H
+
+/// @file
+/// @brief Delegate library blocking call completion primitive.
+///
+/// @details A `Completion` synchronizes one waiting source thread with one destination
+/// thread using a single atomic state word. The destination thread claims the call
+/// with `TryStart()` and publishes the result with `Complete()`. The source thread
+/// blocks in `Wait()` and abandons the call if the timeout expires before the
+/// destination thread claims it. A destination thread that drops the call unclaimed
+/// calls `Cancel()` to release the waiting source thread. The mutex and condition variable are only used if the
+/// source thread parks, so the destination thread only wakes a parked waiter.
+///
+/// Before parking, the source thread optionally spins using the CPU pause instruction
+/// and then yields, as configured by a `SpinPolicy`. A short target function call on an
+/// idle destination thread then completes without a context switch on either side. The
+/// default policy parks immediately; latency sensitive callers opt in per delegate.
+
+#include "DelegateOpt.h"
+#include <condition_variable>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// Fix compiler error on Windows
+#undef max
+
+namespace DelegateLib {
+
+/// @brief Source thread busy wait phase before parking on a blocking call.
+struct SpinPolicy
+{
+	/// Number of CPU pause instruction iterations before yielding
+	std::uint32_t spins = 0;
+
+	/// Number of `std::this_thread::yield()` iterations before parking
+	std::uint32_t yields = 0;
+
+	/// Get the default spin policy. The source thread parks immediately so a blocking 
+	/// call does not burn CPU time that other threads could use. Latency sensitive callers 
+	/// opt in to spinning per delegate using `SetSpinPolicy()`.
+	/// @return The default policy.
+	static SpinPolicy Default()
+	{
+		return SpinPolicy{ 0, 0 };
+	}
+};
+
+/// Hint to the CPU that the calling thread is spin waiting.
+inline void CpuRelax()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+	_mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+	__asm__ __volatile__("yield");
+#endif
+}
+
+/// @brief Single waiter, single completer blocking call completion.
+class Completion
+{
+public:
+	Completion() = default;
+	~Completion() = default;
+
+	/// Called by the destination thread to claim the call before invoking the target.
+	/// @return `true` if claimed. `false` if the source thread abandoned the call and
+	/// the target function must not be invoked.
+	bool TryStart()
+	{
+		std::uint32_t state = m_state.load(std::memory_order_acquire);
+		while ((state & STATE_MASK) == WAITING)
+		{
+			// Preserve the parked flag set concurrently by the source thread
+			if (m_state.compare_exchange_weak(state, (state & PARKED) | RUNNING,
+				std::memory_order_acquire, std::memory_order_acquire))
+				return true;
+		}
+		return false;
+	}
+
+	/// Called by the destination thread once the claimed target function call completes.
+	/// The source thread is only woken if parked.
+	void Complete()
+	{
+		std::uint32_t state = m_state.exchange(COMPLETED, std::memory_order_acq_rel);
+		if (state & PARKED)
+		{
+			// Acquire the lock so the notify cannot occur between the waiter
+			// predicate check and the waiter blocking
+			{
+				std::lock_guard<std::mutex> lk(m_lock);
+			}
+			m_cond.notify_one();
+		}
+	}
+
+	/// Called by the destination thread to drop an unclaimed call without invoking the
+	/// target function. The source thread returns from `Wait()` as if the timeout expired.
+	/// @return `true` if cancelled. `false` if the call was already claimed or abandoned.
+	bool Cancel()
+	{
+		std::uint32_t state = m_state.load(std::memory_order_acquire);
+		while ((state & STATE_MASK) == WAITING)
+		{
+			if (m_state.compare_exchange_weak(state, ABANDONED,
+				std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				if (state & PARKED)
+				{
+					{
+						std::lock_guard<std::mutex> lk(m_lock);
+					}
+					m_cond.notify_one();
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// Called by the source thread to wait for the destination thread to complete.
+	/// @details If the timeout expires before the destination thread claims the call,
+	/// the call is abandoned. If the destination thread already claimed the call, the
+	/// source thread waits until the call completes since the call arguments are
+	/// shared with the source thread.
+	/// @param[in] timeout - timeout in milliseconds
+	/// @param[in] spin - the busy wait phase before parking. Bounded by `timeout`.
+	/// @return `true` if the destination thread completed the call, `false` if abandoned
+	/// or cancelled.
+	bool Wait(std::chrono::milliseconds timeout, const SpinPolicy& spin = SpinPolicy())
+	{
+		std::uint32_t state = m_state.load(std::memory_order_acquire);
+		if (IsDone(state))
+			return IsCompleted(state);
+
+		// Spin then yield before parking
+		for (std::uint32_t i = 0; i < spin.spins; i++)
+		{
+			CpuRelax();
+			state = m_state.load(std::memory_order_acquire);
+			if (IsDone(state))
+				return IsCompleted(state);
+		}
+		if (spin.yields > 0)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (std::uint32_t i = 0; i < spin.yields; i++)
+			{
+				std::this_thread::yield();
+				state = m_state.load(std::memory_order_acquire);
+				if (IsDone(state))
+					return IsCompleted(state);
+				if (timeout != std::chrono::milliseconds::max() &&
+					std::chrono::steady_clock::now() - start >= timeout)
+					break;
+			}
+			if (timeout != std::chrono::milliseconds::max())
+			{
+				auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+					std::chrono::steady_clock::now() - start);
+				timeout = elapsed < timeout ? timeout - elapsed : std::chrono::milliseconds(0);
+			}
+		}
+
+		std::unique_lock<std::mutex> lk(m_lock);
+		state = m_state.fetch_or(PARKED, std::memory_order_acq_rel);
+		if (IsDone(state))
+			return IsCompleted(state);
+
+		auto done = [this] { return IsDone(m_state.load(std::memory_order_acquire)); };
+		if (timeout == std::chrono::milliseconds::max())
+		{
+			m_cond.wait(lk, done);
+			return IsCompleted();
+		}
+		if (m_cond.wait_for(lk, timeout, done))
+			return IsCompleted();
+
+		// Timeout expired. Abandon the call unless the destination thread claimed it.
+		state = PARKED | WAITING;
+		if (m_state.compare_exchange_strong(state, ABANDONED, std::memory_order_acq_rel))
+			return false;
+
+		m_cond.wait(lk, done);
+		return IsCompleted();
+	}
+
+	/// Check if the destination thread completed the call.
+	/// @return `true` if completed.
+	bool IsCompleted() const { return IsCompleted(m_state.load(std::memory_order_acquire)); }
+
+private:
+	// Prevent copying objects
+	Completion(const Completion&) = delete;
+	Completion& operator=(const Completion&) = delete;
+
+	static constexpr std::uint32_t WAITING = 0;		///< Source waiting, call not claimed
+	static constexpr std::uint32_t RUNNING = 1;		///< Destination claimed the call
+	static constexpr std::uint32_t COMPLETED = 2;	///< Destination completed the call
+	static constexpr std::uint32_t ABANDONED = 3;	///< Source timeout or destination cancel, call not invoked
+	static constexpr std::uint32_t STATE_MASK = 3;
+	static constexpr std::uint32_t PARKED = 4;		///< Source blocked on m_cond
+
+	static bool IsCompleted(std::uint32_t state) { return (state & STATE_MASK) == COMPLETED; }
+	static bool IsDone(std::uint32_t state) { return (state & STATE_MASK) >= COMPLETED; }
+
+	std::atomic<std::uint32_t> m_state{ WAITING };
+	std::condition_variable m_cond;
+	std::mutex m_lock;
+};
+
+}
+
+#endif
@@ -18,13 +18,40 @@
 /// 
 /// * `std::function` compares the function signature type, not the underlying object instance.
 /// See `DelegateFunction<>` class for more info.
+/// 
+/// * Two delegates compare equal only if the most derived delegate types match. e.g. a 
+/// `DelegateFree<>` is never equal to a `DelegateFreeAsync<>`.
 
 #include <functional>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include "DelegateOpt.h"
+#include "DelegateTypeId.h"
 
 namespace DelegateLib {
 
+/// Combine a hash value with another hash value.
+/// @param[in] seed The hash value to combine into.
+/// @param[in] value The hash value to combine.
+/// @return The combined hash value.
+inline std::size_t DelegateHashCombine(std::size_t seed, std::size_t value) noexcept {
+    return seed ^ (value + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2));
+}
+
+/// Hash the object representation of a value, such as a member function pointer.
+/// @param[in] data The bytes to hash.
+/// @param[in] size The number of bytes.
+/// @return The FNV-1a hash value.
+inline std::size_t DelegateHashBytes(const void* data, std::size_t size) noexcept {
+    auto bytes = static_cast<const unsigned char*>(data);
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < size; i++)
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    return static_cast<std::size_t>(hash);
+}
+
 /// @brief Non-template base class for all delegates.
 class DelegateBase {
 public:
@@ -53,6 +80,20 @@ public:
     /// @return `true` if the objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& other) const = 0;
 
+    /// @brief Get the most derived delegate type identifier.
+    /// @details Used by `Equal()` to compare delegate types without RTTI. 
+    /// @return The unique type identifier of the most derived delegate class.
+    virtual DelegateTypeId GetTypeId() const noexcept = 0;
+
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @details Delegates that compare equal return the same hash value. Used by 
+    /// containers to index delegates. Derived classes combine the delegate type 
+    /// with the bound object, function and thread.
+    /// @return The delegate hash value.
+    virtual std::size_t Hash() const noexcept {
+        return std::hash<DelegateTypeId>()(GetTypeId());
+    }
+
     /// @brief Clone a delegate instance.
     /// @details Use Clone() to provide a deep copy using a base pointer. Covariant 
     /// overloading is used so that a Clone() method return type is a more 
@@ -61,6 +102,19 @@ public:
     /// @post The caller is responsible for deleting the clone instance. 
     virtual DelegateBase* Clone() const = 0;
 
+    /// @brief Clone a delegate instance into caller provided storage.
+    /// @details Use CloneTo() to store a copy inline within a container. Derived 
+    /// classes override to copy construct within `buffer` if the instance fits. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A copy constructed within `buffer`, or `nullptr` if the instance
+    /// does not fit and `Clone()` must be used instead.
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual DelegateBase* CloneTo(void* buffer, std::size_t size) const { 
+        (void)buffer; (void)size;
+        return nullptr; 
+    }
+
     // Optional fixed block allocator for delegates created on the heap 
     // using operator new(). See USE_ALLOCATOR in DelegateOpt.h and 
     // ENABLE_ALLOCATOR in CMakeLists.txt.
@@ -86,6 +140,14 @@ public:
     /// @return A new Delegate instance created on the heap. 
     /// @post The caller is responsible for deleting the instance.
     virtual Delegate* Clone() const = 0;
+
+    /// @brief Clone an instance of a Delegate instance into caller provided storage.
+    /// @return A new Delegate instance within `buffer`, or `nullptr` if it does not fit.
+    /// @post The caller is responsible for calling the instance destructor.
+    virtual Delegate* CloneTo(void* buffer, std::size_t size) const override { 
+        (void)buffer; (void)size;
+        return nullptr; 
+    }
 };
 
 template <class R>
@@ -145,6 +207,26 @@ public:
         return new(std::nothrow) ClassType(*this); 
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -193,11 +275,19 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_func == derivedRhs->m_func;
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the delegate type and bound function.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(std::hash<DelegateTypeId>()(this->GetTypeId()),
+            DelegateHashBytes(&m_func, sizeof(m_func)));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -354,6 +444,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -408,12 +518,21 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_func == derivedRhs->m_func &&
             m_object == derivedRhs->m_object;
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the delegate type, bound object and member function.
+    virtual std::size_t Hash() const noexcept override {
+        std::size_t hash = DelegateHashCombine(std::hash<DelegateTypeId>()(this->GetTypeId()),
+            std::hash<const void*>()(m_object.get()));
+        return DelegateHashCombine(hash, DelegateHashBytes(&m_func, sizeof(m_func)));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -489,6 +608,10 @@ class DelegateFunction; // Not defined
 /// 
 /// Depending on how usage, this may never be a issue but its worth noting. 
 /// 
+/// If RTTI is disabled (e.g. `-fno-rtti`), `target_type()` is unavailable. Free function 
+/// pointer targets compare the function address and all other callable targets compare 
+/// equal to each other, i.e. only the function signature type is compared.
+/// 
 /// The other delegate classes has no such limitations and works under all conditions,
 /// including comparing two instance functions of the same class. 
 /// 
@@ -552,6 +675,26 @@ public:
         return new(std::nothrow) ClassType(*this); 
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -600,14 +743,25 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         if (derivedRhs) {
             // If both delegates are empty, they are equal
             if (Empty() && derivedRhs->Empty())
                 return true;
 
-            if (m_func && derivedRhs->m_func)
+            if (m_func && derivedRhs->m_func) {
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
                 return m_func.target_type() == derivedRhs->m_func.target_type();
+#else
+                // Without RTTI only free function targets are distinguishable
+                auto func = m_func.template target<RetType(*)(Args...)>();
+                auto rhsFunc = derivedRhs->m_func.template target<RetType(*)(Args...)>();
+                if (func || rhsFunc)
+                    return func && rhsFunc && *func == *rhsFunc;
+                return true;
+#endif
+            }
 
             return false;
         }
@@ -615,6 +769,17 @@ public:
         return false;  // Return false if dynamic cast failed
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the delegate type and stored callable type.
+    virtual std::size_t Hash() const noexcept override {
+        std::size_t hash = std::hash<DelegateTypeId>()(this->GetTypeId());
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+        if (m_func)
+            hash = DelegateHashCombine(hash, m_func.target_type().hash_code());
+#endif
+        return hash;
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -12,8 +12,9 @@
 /// sending a clone of the object to the destination thread message queue. The destination 
 /// thread calls `Invoke()` to invoke the target function.
 /// 
-/// Argument data is created on the heap using `operator new` for transport thought a thread 
-/// message queue. An optional fixed-block allocator is available. See `USE_ALLOCATOR`. 
+/// Argument data is copied by value into the message for transport thought a thread message 
+/// queue. Pointer and reference arguments are bound to the copies when the target function is 
+/// invoked. An optional fixed-block allocator is available. See `USE_ALLOCATOR`. 
 /// 
 /// `RetType operator()(Args... args)` - called by the source thread to initiate the async
 /// function call. May throw `std::bad_alloc` if dynamic storage allocation fails and `USE_ASSERTS` 
@@ -48,39 +49,152 @@
 #include "Delegate.h"
 #include "DelegateThread.h"
 #include "DelegateInvoker.h"
+#include "DelegateFuture.h"
+#include "arg_value.h"
 #include <tuple>
+#include <optional>
+#include <mutex>
 
 namespace DelegateLib {
 
-/// @brief Stores all function arguments suitable for non-blocking asynchronous calls.
-/// Argument data is stored in the heap.
+/// @brief Stores a delegate clone and all function arguments suitable for non-blocking 
+/// asynchronous calls. The delegate clone and argument copies are embedded within the 
+/// message so the clone, argument storage and message are created using a single allocation. 
+/// @tparam TInvoker The delegate type that invokes the target function on the destination thread.
 /// @tparam Args The argument types of the bound delegate function.
-template <class...Args>
+template <class TInvoker, class...Args>
 class DelegateAsyncMsg : public DelegateMsg
 {
 public:
     /// Constructor
-    /// @param[in] invoker - the invoker instance
+    /// @param[in] invoker - the invoker instance to copy into the message
     /// @param[in] args - a parameter pack of all target function arguments
-    /// @throws std::bad_alloc If make_tuble_heap() fails to obtain memory and USE_ASSERTS not defined.
-    DelegateAsyncMsg(std::shared_ptr<IDelegateInvoker> invoker, Args... args) : DelegateMsg(invoker),
-        m_args(make_tuple_heap(m_heapMem, m_start, std::forward<Args>(args)...)) { }
+    DelegateAsyncMsg(const TInvoker& invoker, Args... args) : m_invoker(invoker),
+        m_args(std::forward<Args>(args)...) { 
+        SetDelegateInvoker(&m_invoker);
+        SetTypeId(GetDelegateTypeId<DelegateAsyncMsg>());
+    }
 
     virtual ~DelegateAsyncMsg() = default;
 
-    /// Get all function arguments that were created on the heap
+    /// Get all function arguments bound to the argument copies stored within the 
+    /// message. Call once when invoking the target function.
     /// @return A tuple of all function arguments
-    std::tuple<Args...>& GetArgs() { return m_args; }
+    std::tuple<typename arg_value<Args>::arg_type...> GetArgs() { 
+        return std::apply([](auto&... arg) { 
+            return std::tuple<typename arg_value<Args>::arg_type...>(arg.get()...); 
+        }, m_args);
+    }
+
+    /// A non-blocking message may always be dropped unless invoked.
+    /// @return `true` always.
+    virtual bool TryDiscard() override { return true; }
+
+    /// Get the delegate clone used to invoke the target function.
+    /// @return The delegate clone.
+    virtual const DelegateBase* GetDelegate() const override { return &m_invoker; }
 
 private:
-    /// A list of heap allocated argument memory blocks
-    xlist<std::shared_ptr<heap_arg_deleter_base>> m_heapMem;
+    /// The delegate clone used to invoke the target function
+    TInvoker m_invoker;
 
-    /// An empty starting tuple
-    std::tuple<> m_start;
+    /// A tuple with a copy of each function argument
+    std::tuple<arg_value<Args>...> m_args;
+};
 
-    /// A tuple with each element stored within the heap
-    std::tuple<Args...> m_args;
+/// @brief Stores a delegate clone, all function arguments and the promise fulfilled by 
+/// the destination thread for `AsyncInvokeFuture()` calls.
+/// @tparam TInvoker The delegate type that invokes the target function on the destination thread.
+/// @tparam RetType The return type of the bound delegate function.
+/// @tparam Args The argument types of the bound delegate function.
+template <class TInvoker, class RetType, class...Args>
+class DelegateAsyncFutureMsg : public DelegateAsyncMsg<TInvoker, Args...>
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the invoker instance to copy into the message
+    /// @param[in] promise - the promise to fulfill once the target function returns
+    /// @param[in] args - a parameter pack of all target function arguments
+    DelegateAsyncFutureMsg(const TInvoker& invoker, DelegatePromise<RetType>&& promise, Args... args) : 
+        DelegateAsyncMsg<TInvoker, Args...>(invoker, std::forward<Args>(args)...), 
+        m_promise(std::move(promise)) {
+        this->SetTypeId(GetDelegateTypeId<DelegateAsyncFutureMsg>());
+    }
+
+    virtual ~DelegateAsyncFutureMsg() = default;
+
+    /// Get the promise fulfilled by the destination thread.
+    /// @return The promise reference.
+    DelegatePromise<RetType>& GetPromise() { return m_promise; }
+
+private:
+    /// The promise fulfilled by the destination thread
+    DelegatePromise<RetType> m_promise;
+};
+
+/// @brief Stores a delegate clone and the latest function arguments for coalescing 
+/// asynchronous calls. While the message is pending within the destination thread 
+/// `DelegateCoalesceTable`, a source thread replaces the arguments in place.
+/// @tparam TInvoker The delegate type that invokes the target function on the destination thread.
+/// @tparam Args The argument types of the bound delegate function.
+template <class TInvoker, class...Args>
+class DelegateAsyncCoalesceMsg : public DelegateMsg
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the invoker instance to copy into the message
+    /// @param[in] table - the destination thread pending coalescing message table
+    /// @param[in] args - a parameter pack of all target function arguments
+    DelegateAsyncCoalesceMsg(const TInvoker& invoker, DelegateCoalesceTable& table, Args... args) : 
+        m_invoker(invoker), m_table(table) {
+        m_args.emplace(std::forward<Args>(args)...);
+        SetDelegateInvoker(&m_invoker);
+        SetTypeId(GetDelegateTypeId<DelegateAsyncCoalesceMsg>());
+    }
+
+    virtual ~DelegateAsyncCoalesceMsg() = default;
+
+    /// Replace the function arguments of the pending message. Called by the source 
+    /// thread with the table locked.
+    /// @param[in] args - a parameter pack of all target function arguments
+    void Update(Args... args) { m_args.emplace(std::forward<Args>(args)...); }
+
+    /// Remove the message from the pending table so the arguments are no longer 
+    /// updated. Called by the destination thread before invoking the target function.
+    void Claim() {
+        std::lock_guard<std::mutex> lk(m_table.GetLock());
+        m_table.Remove(this);
+    }
+
+    /// Get all function arguments bound to the argument copies stored within the 
+    /// message. Call once after `Claim()` when invoking the target function.
+    /// @return A tuple of all function arguments
+    std::tuple<typename arg_value<Args>::arg_type...> GetArgs() { 
+        return std::apply([](auto&... arg) { 
+            return std::tuple<typename arg_value<Args>::arg_type...>(arg.get()...); 
+        }, *m_args);
+    }
+
+    /// Remove the message from the pending table before the message is dropped.
+    /// @return `true` always.
+    virtual bool TryDiscard() override { 
+        Claim();
+        return true; 
+    }
+
+    /// Get the delegate clone used to invoke the target function.
+    /// @return The delegate clone.
+    virtual const DelegateBase* GetDelegate() const override { return &m_invoker; }
+
+private:
+    /// The delegate clone used to invoke the target function
+    TInvoker m_invoker;
+
+    /// The destination thread pending coalescing message table
+    DelegateCoalesceTable& m_table;
+
+    /// A tuple with a copy of each latest function argument
+    std::optional<std::tuple<arg_value<Args>...>> m_args;
 };
 
 template <class R>
@@ -117,7 +231,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFreeAsync(ClassType&& rhs) noexcept : 
-        BaseType(rhs), m_thread(rhs.m_thread) {
+        BaseType(rhs), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_coalesce(rhs.m_coalesce) {
         rhs.Clear();
     }
 
@@ -142,6 +256,8 @@ public:
     /// @param[in] rhs The object whose state is to be copied.
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
+        m_priority = rhs.m_priority;
+        m_coalesce = rhs.m_coalesce;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -154,6 +270,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -172,6 +308,8 @@ public:
         if (&rhs != this) {
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
+            m_priority = rhs.m_priority;
+            m_coalesce = rhs.m_coalesce;
         }
         return *this;
     }
@@ -185,12 +323,19 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_thread == derivedRhs->m_thread &&
             BaseType::Equal(rhs);
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the bound target function and destination thread.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(BaseType::Hash(), std::hash<const void*>()(m_thread));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -225,9 +370,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -242,17 +387,20 @@ public:
         if (m_sync) {
             // Invoke the target function directly
             return BaseType::operator()(std::forward<Args>(args)...);
+        } else if (m_coalesce) {
+            // Update the pending message or dispatch a new message
+            DispatchCoalesce(std::forward<Args>(args)...);
+            return RetType();
         } else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = std::make_shared<DelegateAsyncMsg<Args...>>(delegate, std::forward<Args>(args)...);
+            // Create a new message instance for sending to the destination thread. The 
+            // message holds a clone of this delegate within the same allocation.
+            auto msg = xmake_shared<DelegateAsyncMsg<ClassType, Args...>>(*this, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
@@ -281,6 +429,44 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the return 
+    /// value. Called by the source thread. Always safe to call.
+    /// @details The destination thread fulfills the future directly within `Invoke()` once 
+    /// the target function returns. The source thread does not block and no additional 
+    /// thread is required to wait for the result. Use `DelegateFuture::Then()` to chain 
+    /// a continuation.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future for the target function return value. Completes without a 
+    /// value if the target function is never invoked.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    DelegateFuture<RetType> AsyncInvokeFuture(Args... args) {
+        DelegatePromise<RetType> promise;
+        auto future = promise.GetFuture();
+        if (this->Empty())
+            return future;
+
+        // Synchronously invoke the target function?
+        if (m_sync) {
+            promise.SetValueFrom([&]() { return BaseType::operator()(std::forward<Args>(args)...); });
+        } else {
+            auto msg = xmake_shared<DelegateAsyncFutureMsg<ClassType, RetType, Args...>>(*this, 
+                std::move(promise), std::forward<Args>(args)...);
+            if (!msg)
+                BAD_ALLOC();
+
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+
+            auto thread = this->GetThread();
+            if (thread) {
+                // Dispatch message onto the callback destination thread. Invoke() 
+                // will fulfill the future.
+                thread->DispatchDelegate(msg);
+            }
+        }
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
@@ -290,8 +476,29 @@ public:
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
     virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+        // Claim a coalescing message so the next call dispatches a new message
+        auto coalesceMsg = DelegateMsgCast<DelegateAsyncCoalesceMsg<ClassType, Args...>>(msg);
+        if (coalesceMsg) {
+            coalesceMsg->Claim();
+            m_sync = true;
+            std::apply(&BaseType::operator(), 
+                std::tuple_cat(std::make_tuple(this), coalesceMsg->GetArgs()));
+            return true;
+        }
+
+        // Fulfill the promise for an AsyncInvokeFuture() message
+        auto futureMsg = DelegateMsgCast<DelegateAsyncFutureMsg<ClassType, RetType, Args...>>(msg);
+        if (futureMsg) {
+            m_sync = true;
+            futureMsg->GetPromise().SetValueFrom([&]() {
+                return std::apply(&BaseType::operator(), 
+                    std::tuple_cat(std::make_tuple(this), futureMsg->GetArgs()));
+            });
+            return true;
+        }
+
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+        auto delegateMsg = DelegateMsgCast<DelegateAsyncMsg<ClassType, Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
@@ -306,12 +513,77 @@ public:
 
     ///@brief Get the destination thread that the target function is invoked on.
     // @return The target thread.
-    DelegateThread* GetThread() noexcept { return m_thread; }
+    DelegateThread* GetThread() const noexcept { return m_thread; }
+
+    /// @brief Set the dispatch priority of messages sent to the destination thread.
+    /// @param[in] priority The dispatch priority. Defaults to `DelegatePriority::NORMAL`.
+    void SetPriority(DelegatePriority priority) noexcept { m_priority = priority; }
+
+    /// @brief Get the dispatch priority of messages sent to the destination thread.
+    /// @return The dispatch priority.
+    DelegatePriority GetPriority() const noexcept { return m_priority; }
+
+    /// @brief Enable latest value wins coalescing. 
+    /// @details While a message for the same target function and destination thread 
+    /// is queued but not yet invoked, `operator()` replaces the queued message arguments 
+    /// instead of dispatching another message. The target function runs once with the 
+    /// latest arguments. Delegates are matched using `Equal()`, so any coalescing delegate 
+    /// bound to the same target and thread updates the same pending message. 
+    /// `AsyncInvokeFuture()` calls are not coalesced.
+    /// @param[in] coalesce `true` to coalesce calls. Defaults to `false`.
+    void SetCoalesce(bool coalesce) noexcept { m_coalesce = coalesce; }
+
+    /// @brief Check if latest value wins coalescing is enabled.
+    /// @return `true` if calls are coalesced.
+    bool IsCoalesce() const noexcept { return m_coalesce; }
 
 private:
+    /// Update the pending coalescing message bound to the same target function and
+    /// destination thread, or dispatch a new message if none is pending.
+    /// @param[in] args The function arguments, if any.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    void DispatchCoalesce(Args... args) {
+        using CoalesceMsg = DelegateAsyncCoalesceMsg<ClassType, Args...>;
+        auto thread = this->GetThread();
+        if (!thread)
+            return;
+
+        std::shared_ptr<CoalesceMsg> msg;
+        auto& table = thread->GetCoalesceTable();
+        {
+            std::lock_guard<std::mutex> lk(table.GetLock());
+            auto pending = DelegateMsgCast<CoalesceMsg>(table.Find(*this));
+            if (pending) {
+                pending->Update(std::forward<Args>(args)...);
+                return;
+            }
+
+            msg = xmake_shared<CoalesceMsg>(*this, table, std::forward<Args>(args)...);
+            if (!msg)
+                BAD_ALLOC();
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+            table.Add(msg);
+        }
+
+        try {
+            thread->DispatchDelegate(msg);
+        } catch (...) {
+            // Not queued so never invoked. Later calls dispatch a new message.
+            msg->Claim();
+            throw;
+        }
+    }
+
     /// The target thread to invoke the delegate function.
     DelegateThread* m_thread = nullptr;   
 
+    /// The dispatch priority of messages sent to the destination thread
+    DelegatePriority m_priority = DelegatePriority::NORMAL;
+
+    /// Flag to enable latest value wins coalescing
+    bool m_coalesce = false;
+
     /// Flag to control synchronous vs asynchronous target invoke behavior.
     bool m_sync = false;        
 
@@ -380,7 +652,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateMemberAsync(ClassType&& rhs) noexcept :
-        BaseType(rhs), m_thread(rhs.m_thread) {
+        BaseType(rhs), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_coalesce(rhs.m_coalesce) {
         rhs.Clear();
     }
 
@@ -442,6 +714,8 @@ public:
     /// @param[in] rhs The object whose state is to be copied.
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
+        m_priority = rhs.m_priority;
+        m_coalesce = rhs.m_coalesce;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -454,6 +728,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -472,6 +766,8 @@ public:
         if (&rhs != this) {
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
+            m_priority = rhs.m_priority;
+            m_coalesce = rhs.m_coalesce;
         }
         return *this;
     }
@@ -485,12 +781,19 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_thread == derivedRhs->m_thread &&
             BaseType::Equal(rhs);
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the bound target function and destination thread.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(BaseType::Hash(), std::hash<const void*>()(m_thread));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -525,9 +828,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -542,17 +845,20 @@ public:
         if (m_sync) {
             // Invoke the target function directly
             return BaseType::operator()(std::forward<Args>(args)...);
+        } else if (m_coalesce) {
+            // Update the pending message or dispatch a new message
+            DispatchCoalesce(std::forward<Args>(args)...);
+            return RetType();
         } else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = std::make_shared<DelegateAsyncMsg<Args...>>(delegate, std::forward<Args>(args)...);
+            // Create a new message instance for sending to the destination thread. The 
+            // message holds a clone of this delegate within the same allocation.
+            auto msg = xmake_shared<DelegateAsyncMsg<ClassType, Args...>>(*this, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
@@ -581,6 +887,44 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the return 
+    /// value. Called by the source thread. Always safe to call.
+    /// @details The destination thread fulfills the future directly within `Invoke()` once 
+    /// the target function returns. The source thread does not block and no additional 
+    /// thread is required to wait for the result. Use `DelegateFuture::Then()` to chain 
+    /// a continuation.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future for the target function return value. Completes without a 
+    /// value if the target function is never invoked.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    DelegateFuture<RetType> AsyncInvokeFuture(Args... args) {
+        DelegatePromise<RetType> promise;
+        auto future = promise.GetFuture();
+        if (this->Empty())
+            return future;
+
+        // Synchronously invoke the target function?
+        if (m_sync) {
+            promise.SetValueFrom([&]() { return BaseType::operator()(std::forward<Args>(args)...); });
+        } else {
+            auto msg = xmake_shared<DelegateAsyncFutureMsg<ClassType, RetType, Args...>>(*this, 
+                std::move(promise), std::forward<Args>(args)...);
+            if (!msg)
+                BAD_ALLOC();
+
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+
+            auto thread = this->GetThread();
+            if (thread) {
+                // Dispatch message onto the callback destination thread. Invoke() 
+                // will fulfill the future.
+                thread->DispatchDelegate(msg);
+            }
+        }
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
@@ -590,8 +934,29 @@ public:
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
     virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+        // Claim a coalescing message so the next call dispatches a new message
+        auto coalesceMsg = DelegateMsgCast<DelegateAsyncCoalesceMsg<ClassType, Args...>>(msg);
+        if (coalesceMsg) {
+            coalesceMsg->Claim();
+            m_sync = true;
+            std::apply(&BaseType::operator(), 
+                std::tuple_cat(std::make_tuple(this), coalesceMsg->GetArgs()));
+            return true;
+        }
+
+        // Fulfill the promise for an AsyncInvokeFuture() message
+        auto futureMsg = DelegateMsgCast<DelegateAsyncFutureMsg<ClassType, RetType, Args...>>(msg);
+        if (futureMsg) {
+            m_sync = true;
+            futureMsg->GetPromise().SetValueFrom([&]() {
+                return std::apply(&BaseType::operator(), 
+                    std::tuple_cat(std::make_tuple(this), futureMsg->GetArgs()));
+            });
+            return true;
+        }
+
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+        auto delegateMsg = DelegateMsgCast<DelegateAsyncMsg<ClassType, Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
@@ -606,12 +971,77 @@ public:
 
     ///@brief Get the destination thread that the target function is invoked on.
     // @return The target thread.
-    DelegateThread* GetThread() noexcept { return m_thread; }
+    DelegateThread* GetThread() const noexcept { return m_thread; }
+
+    /// @brief Set the dispatch priority of messages sent to the destination thread.
+    /// @param[in] priority The dispatch priority. Defaults to `DelegatePriority::NORMAL`.
+    void SetPriority(DelegatePriority priority) noexcept { m_priority = priority; }
+
+    /// @brief Get the dispatch priority of messages sent to the destination thread.
+    /// @return The dispatch priority.
+    DelegatePriority GetPriority() const noexcept { return m_priority; }
+
+    /// @brief Enable latest value wins coalescing. 
+    /// @details While a message for the same target function and destination thread 
+    /// is queued but not yet invoked, `operator()` replaces the queued message arguments 
+    /// instead of dispatching another message. The target function runs once with the 
+    /// latest arguments. Delegates are matched using `Equal()`, so any coalescing delegate 
+    /// bound to the same target and thread updates the same pending message. 
+    /// `AsyncInvokeFuture()` calls are not coalesced.
+    /// @param[in] coalesce `true` to coalesce calls. Defaults to `false`.
+    void SetCoalesce(bool coalesce) noexcept { m_coalesce = coalesce; }
+
+    /// @brief Check if latest value wins coalescing is enabled.
+    /// @return `true` if calls are coalesced.
+    bool IsCoalesce() const noexcept { return m_coalesce; }
 
 private:
+    /// Update the pending coalescing message bound to the same target function and
+    /// destination thread, or dispatch a new message if none is pending.
+    /// @param[in] args The function arguments, if any.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    void DispatchCoalesce(Args... args) {
+        using CoalesceMsg = DelegateAsyncCoalesceMsg<ClassType, Args...>;
+        auto thread = this->GetThread();
+        if (!thread)
+            return;
+
+        std::shared_ptr<CoalesceMsg> msg;
+        auto& table = thread->GetCoalesceTable();
+        {
+            std::lock_guard<std::mutex> lk(table.GetLock());
+            auto pending = DelegateMsgCast<CoalesceMsg>(table.Find(*this));
+            if (pending) {
+                pending->Update(std::forward<Args>(args)...);
+                return;
+            }
+
+            msg = xmake_shared<CoalesceMsg>(*this, table, std::forward<Args>(args)...);
+            if (!msg)
+                BAD_ALLOC();
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+            table.Add(msg);
+        }
+
+        try {
+            thread->DispatchDelegate(msg);
+        } catch (...) {
+            // Not queued so never invoked. Later calls dispatch a new message.
+            msg->Claim();
+            throw;
+        }
+    }
+
     /// The target thread to invoke the delegate function.
     DelegateThread* m_thread = nullptr;   
 
+    /// The dispatch priority of messages sent to the destination thread
+    DelegatePriority m_priority = DelegatePriority::NORMAL;
+
+    /// Flag to enable latest value wins coalescing
+    bool m_coalesce = false;
+
     /// Flag to control synchronous vs asynchronous target invoke behavior.
     bool m_sync = false;        
 
@@ -658,7 +1088,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFunctionAsync(ClassType&& rhs) noexcept :
-        BaseType(rhs), m_thread(rhs.m_thread) {
+        BaseType(rhs), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_coalesce(rhs.m_coalesce) {
         rhs.Clear();
     }
 
@@ -683,6 +1113,8 @@ public:
     /// @param[in] rhs The object whose state is to be copied.
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
+        m_priority = rhs.m_priority;
+        m_coalesce = rhs.m_coalesce;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -695,6 +1127,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -713,6 +1165,8 @@ public:
         if (&rhs != this) {
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
+            m_priority = rhs.m_priority;
+            m_coalesce = rhs.m_coalesce;
         }
         return *this;
     }
@@ -726,12 +1180,19 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_thread == derivedRhs->m_thread &&
             BaseType::Equal(rhs);
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the bound target function and destination thread.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(BaseType::Hash(), std::hash<const void*>()(m_thread));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -766,9 +1227,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -783,17 +1244,20 @@ public:
         if (m_sync) {
             // Invoke the target function directly
             return BaseType::operator()(std::forward<Args>(args)...);
+        } else if (m_coalesce) {
+            // Update the pending message or dispatch a new message
+            DispatchCoalesce(std::forward<Args>(args)...);
+            return RetType();
         } else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = std::make_shared<DelegateAsyncMsg<Args...>>(delegate, std::forward<Args>(args)...);
+            // Create a new message instance for sending to the destination thread. The 
+            // message holds a clone of this delegate within the same allocation.
+            auto msg = xmake_shared<DelegateAsyncMsg<ClassType, Args...>>(*this, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
@@ -822,6 +1286,44 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the return 
+    /// value. Called by the source thread. Always safe to call.
+    /// @details The destination thread fulfills the future directly within `Invoke()` once 
+    /// the target function returns. The source thread does not block and no additional 
+    /// thread is required to wait for the result. Use `DelegateFuture::Then()` to chain 
+    /// a continuation.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future for the target function return value. Completes without a 
+    /// value if the target function is never invoked.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    DelegateFuture<RetType> AsyncInvokeFuture(Args... args) {
+        DelegatePromise<RetType> promise;
+        auto future = promise.GetFuture();
+        if (this->Empty())
+            return future;
+
+        // Synchronously invoke the target function?
+        if (m_sync) {
+            promise.SetValueFrom([&]() { return BaseType::operator()(std::forward<Args>(args)...); });
+        } else {
+            auto msg = xmake_shared<DelegateAsyncFutureMsg<ClassType, RetType, Args...>>(*this, 
+                std::move(promise), std::forward<Args>(args)...);
+            if (!msg)
+                BAD_ALLOC();
+
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+
+            auto thread = this->GetThread();
+            if (thread) {
+                // Dispatch message onto the callback destination thread. Invoke() 
+                // will fulfill the future.
+                thread->DispatchDelegate(msg);
+            }
+        }
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
@@ -831,8 +1333,29 @@ public:
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
     virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+        // Claim a coalescing message so the next call dispatches a new message
+        auto coalesceMsg = DelegateMsgCast<DelegateAsyncCoalesceMsg<ClassType, Args...>>(msg);
+        if (coalesceMsg) {
+            coalesceMsg->Claim();
+            m_sync = true;
+            std::apply(&BaseType::operator(), 
+                std::tuple_cat(std::make_tuple(this), coalesceMsg->GetArgs()));
+            return true;
+        }
+
+        // Fulfill the promise for an AsyncInvokeFuture() message
+        auto futureMsg = DelegateMsgCast<DelegateAsyncFutureMsg<ClassType, RetType, Args...>>(msg);
+        if (futureMsg) {
+            m_sync = true;
+            futureMsg->GetPromise().SetValueFrom([&]() {
+                return std::apply(&BaseType::operator(), 
+                    std::tuple_cat(std::make_tuple(this), futureMsg->GetArgs()));
+            });
+            return true;
+        }
+
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+        auto delegateMsg = DelegateMsgCast<DelegateAsyncMsg<ClassType, Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
@@ -847,12 +1370,77 @@ public:
 
     ///@brief Get the destination thread that the target function is invoked on.
     // @return The target thread.
-    DelegateThread* GetThread() noexcept { return m_thread; }
+    DelegateThread* GetThread() const noexcept { return m_thread; }
+
+    /// @brief Set the dispatch priority of messages sent to the destination thread.
+    /// @param[in] priority The dispatch priority. Defaults to `DelegatePriority::NORMAL`.
+    void SetPriority(DelegatePriority priority) noexcept { m_priority = priority; }
+
+    /// @brief Get the dispatch priority of messages sent to the destination thread.
+    /// @return The dispatch priority.
+    DelegatePriority GetPriority() const noexcept { return m_priority; }
+
+    /// @brief Enable latest value wins coalescing. 
+    /// @details While a message for the same target function and destination thread 
+    /// is queued but not yet invoked, `operator()` replaces the queued message arguments 
+    /// instead of dispatching another message. The target function runs once with the 
+    /// latest arguments. Delegates are matched using `Equal()`, so any coalescing delegate 
+    /// bound to the same target and thread updates the same pending message. 
+    /// `AsyncInvokeFuture()` calls are not coalesced.
+    /// @param[in] coalesce `true` to coalesce calls. Defaults to `false`.
+    void SetCoalesce(bool coalesce) noexcept { m_coalesce = coalesce; }
+
+    /// @brief Check if latest value wins coalescing is enabled.
+    /// @return `true` if calls are coalesced.
+    bool IsCoalesce() const noexcept { return m_coalesce; }
 
 private:
+    /// Update the pending coalescing message bound to the same target function and
+    /// destination thread, or dispatch a new message if none is pending.
+    /// @param[in] args The function arguments, if any.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    void DispatchCoalesce(Args... args) {
+        using CoalesceMsg = DelegateAsyncCoalesceMsg<ClassType, Args...>;
+        auto thread = this->GetThread();
+        if (!thread)
+            return;
+
+        std::shared_ptr<CoalesceMsg> msg;
+        auto& table = thread->GetCoalesceTable();
+        {
+            std::lock_guard<std::mutex> lk(table.GetLock());
+            auto pending = DelegateMsgCast<CoalesceMsg>(table.Find(*this));
+            if (pending) {
+                pending->Update(std::forward<Args>(args)...);
+                return;
+            }
+
+            msg = xmake_shared<CoalesceMsg>(*this, table, std::forward<Args>(args)...);
+            if (!msg)
+                BAD_ALLOC();
+            msg->SetPriority(m_priority);
+            DelegateThread::TraceSend(*msg);
+            table.Add(msg);
+        }
+
+        try {
+            thread->DispatchDelegate(msg);
+        } catch (...) {
+            // Not queued so never invoked. Later calls dispatch a new message.
+            msg->Claim();
+            throw;
+        }
+    }
+
     /// The target thread to invoke the delegate function.
     DelegateThread* m_thread = nullptr;   
 
+    /// The dispatch priority of messages sent to the destination thread
+    DelegatePriority m_priority = DelegatePriority::NORMAL;
+
+    /// Flag to enable latest value wins coalescing
+    bool m_coalesce = false;
+
     /// Flag to control synchronous vs asynchronous target invoke behavior.
     bool m_sync = false;        
 
@@ -864,10 +1452,13 @@ private:
 /// @tparam Args The types of the function arguments.
 /// @param[in] func A pointer to the free function to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateFreeAsync` object bound to the specified free function and thread.
 template <class RetType, class... Args>
-auto MakeDelegate(RetType(*func)(Args... args), DelegateThread& thread) {
-    return DelegateFreeAsync<RetType(Args...)>(func, thread);
+auto MakeDelegate(RetType(*func)(Args... args), DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateFreeAsync<RetType(Args...)>(func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a non-const member function.
@@ -877,10 +1468,13 @@ auto MakeDelegate(RetType(*func)(Args... args), DelegateThread& thread) {
 /// @param[in] object A pointer to the instance of `TClass` that will be used for the delegate.
 /// @param[in] func A pointer to the non-const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsync` object bound to the specified non-const member function and thread.
 template <class TClass, class RetType, class... Args>
-auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args... args), DelegateThread& thread) {
-    return DelegateMemberAsync<TClass, RetType(Args...)>(object, func, thread);
+auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args... args), DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsync<TClass, RetType(Args...)>(object, func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a const member function.
@@ -890,10 +1484,13 @@ auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args... args), Delegat
 /// @param[in] object A pointer to the instance of `TClass` that will be used for the delegate.
 /// @param[in] func A pointer to the const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsync` object bound to the specified const member function and thread.
 template <class TClass, class RetType, class... Args>
-auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args... args) const, DelegateThread& thread) {
-    return DelegateMemberAsync<TClass, RetType(Args...)>(object, func, thread);
+auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args... args) const, DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsync<TClass, RetType(Args...)>(object, func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates a delegate that binds to a const member function.
@@ -903,10 +1500,13 @@ auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args... args) const, D
 /// @param[in] object A pointer to the instance of `TClass` that will be used for the delegate.
 /// @param[in] func A pointer to the non-const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsync` object bound to the specified non-const member function.
 template <class TClass, class RetType, class... Args>
-auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args... args) const, DelegateThread& thread) {
-    return DelegateMemberAsync<const TClass, RetType(Args...)>(object, func, thread);
+auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args... args) const, DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsync<const TClass, RetType(Args...)>(object, func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a non-const member function using a shared pointer.
@@ -916,10 +1516,13 @@ auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args... args) co
 /// @param[in] object A shared pointer to the instance of `TClass` that will be used for the delegate.
 /// @param[in] func A pointer to the non-const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsync` shared pointer bound to the specified non-const member function and thread.
 template <class TClass, class RetVal, class... Args>
-auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args), DelegateThread& thread) {
-    return DelegateMemberAsync<TClass, RetVal(Args...)>(object, func, thread);
+auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args), DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsync<TClass, RetVal(Args...)>(object, func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 
@@ -930,10 +1533,13 @@ auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args...
 /// @param[in] object A shared pointer to the instance of `TClass` that will be used for the delegate.
 /// @param[in] func A pointer to the const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsync` shared pointer bound to the specified const member function and thread.
 template <class TClass, class RetVal, class... Args>
-auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args) const, DelegateThread& thread) {
-    return DelegateMemberAsync<TClass, RetVal(Args...)>(object, func, thread);
+auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args) const, DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsync<TClass, RetVal(Args...)>(object, func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a `std::function`.
@@ -941,10 +1547,13 @@ auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args...
 /// @tparam Args The types of the function arguments.
 /// @param[in] func The `std::function` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateFunctionAsync` object bound to the specified `std::function` and thread.
 template <class RetType, class... Args>
-auto MakeDelegate(std::function<RetType(Args...)> func, DelegateThread& thread) {
-    return DelegateFunctionAsync<RetType(Args...)>(func, thread);
+auto MakeDelegate(std::function<RetType(Args...)> func, DelegateThread& thread, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateFunctionAsync<RetType(Args...)>(func, thread);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 }
@@ -16,12 +16,15 @@
 /// Delegate "`AsyncWait`" series of classes used to invoke a function asynchronously and wait for 
 /// completion by the destination target thread. Invoking a function asynchronously requires making 
 /// a clone of the object to be sent to the destination thread message queue. The destination thread 
-/// calls `Invoke()` to invoke the target function. The source thread blocks on a semaphore 
-/// waiting for the destination thread to complete the function invoke. If the caller timeout expires, 
-/// the target function is not invoked. 
+/// calls `Invoke()` to invoke the target function. The source thread waits on the message 
+/// `Completion` for the destination thread to complete the function invoke. 
 /// 
-/// The `m_lock` mutex is used to protect shared state data between the source and destination 
-/// threads using the two thread-safe functions below:
+/// Each message `Completion` is the only state shared between the source and destination threads. 
+/// The destination thread claims the call with a single atomic compare-and-swap before invoking 
+/// the target function, and marks it complete afterwards. The source thread optionally spins, then 
+/// parks until complete or the timeout expires. On timeout, the source thread abandons the call 
+/// unless already claimed, in which case it waits for completion. An abandoned call is never 
+/// invoked. The two thread-safe functions below use the protocol:
 ///
 /// `RetType operator()(Args... args)` - called by the source thread to initiate the async
 /// function call. May throw `std::bad_alloc` if dynamic storage allocation fails and `USE_ASSERTS` 
@@ -36,8 +39,8 @@
 /// 
 /// * Cannot use rvalue reference (T&&) as a target function argument.
 /// 
-/// * The target function cannot return a `std::unique_ptr` since `AsyncWait` destination 
-/// target thread stores the return value (`m_retVal`) for later use by the calling source thread.
+/// * The target function cannot return a `std::unique_ptr` or a reference. The destination 
+/// thread stores the return value within the message for the calling source thread to move out.
 /// 
 /// * Cannot insert `DelegateMemberAsyncWait` into an ordered container. e.g. `std::list` ok, 
 /// `std::set` not ok.
@@ -55,8 +58,8 @@
 #include "DelegateThread.h"
 #include "DelegateInvoker.h"
 #include <optional>
-#include <any>
 #include <chrono>
+#include <atomic>
 
 namespace DelegateLib {
 
@@ -65,8 +68,12 @@ constexpr auto WAIT_INFINITE = std::chrono::milliseconds::max();
 
 /// @brief Stores all function arguments suitable for blocking asynchronous calls.
 /// Argument data is not stored in the heap.
+/// @details The destination thread writes the target function return value once into the 
+/// typed return value slot. The source thread moves the value out of the slot after the 
+/// call completes. 
+/// @tparam RetType The target function return type.
 /// @tparam Args The target function arguments.
-template <class...Args>
+template <class RetType, class...Args>
 class DelegateAsyncWaitMsg : public DelegateMsg
 {
 public:
@@ -74,7 +81,9 @@ public:
     /// @param[in] invoker - the invoker instance
     /// @param[in] args - a parameter pack of all target function arguments
     DelegateAsyncWaitMsg(std::shared_ptr<IDelegateInvoker> invoker, Args... args) : DelegateMsg(invoker),
-        m_args(std::forward<Args>(args)...) {}
+        m_args(std::forward<Args>(args)...) {
+        SetTypeId(GetDelegateTypeId<DelegateAsyncWaitMsg>());
+    }
 
     virtual ~DelegateAsyncWaitMsg() {}
 
@@ -82,41 +91,48 @@ public:
     /// @return A tuple of all function arguments
     std::tuple<Args...>& GetArgs() { return m_args; }
 
-    /// Get the semaphore used to signal the sending thread that the receiving 
-    /// thread has invoked the target function. 
-    /// @return The semaphore reference.
-    Semaphore& GetSema() { return m_sema; }
-
-    /// Get a mutex shared between sender and receiver threads.
-    /// @return The lock reference.
-    std::mutex& GetLock() { return m_lock; }
+    /// Get the completion used by the receiving thread to claim the call and signal 
+    /// the waiting sending thread that the target function call is complete. 
+    /// @return The completion reference.
+    Completion& GetCompletion() { return m_completion; }
+
+    /// The return value slot type. A `void` target function has an unused `bool` slot.
+    using RetSlot = std::optional<std::conditional_t<std::is_void<RetType>::value, bool, RetType>>;
+
+    /// Get the target function return value slot. Written by the destination thread
+    /// and read by the source thread only after the call completes. 
+    /// @return The return value slot reference.
+    RetSlot& GetRetVal() { return m_retVal; }
+
+    /// Release the waiting source thread before the message is dropped. The source 
+    /// thread returns as if the timeout expired.
+    /// @return `true` always.
+    virtual bool TryDiscard() override { 
+        m_completion.Cancel();
+        return true; 
+    }
 
-    /// True if the sending thread is waiting for the receiver thread to call the function.
-    /// False if the sending thread delegate timeout occurred and is not waiting.
-    /// @return `true` if the sending thread is waiting for the receiving thread to complete
-    /// the target function invoke.
-    bool GetInvokerWaiting() { return m_invokerWaiting; }
+    /// Set the delegate that invokes the message. Used to identify the target 
+    /// function, for instance by `DelegateThreadStats`.
+    /// @param[in] delegate - the invoker delegate. Must remain valid for the message lifetime.
+    void SetDelegate(const DelegateBase* delegate) { m_delegate = delegate; }
 
-    /// Set to true when source thread is waiting for destination thread to complete the 
-    /// function call.
-    /// @param[in] invokerWaiting The status of the invoker waiting flag.
-    void SetInvokerWaiting(bool invokerWaiting) { m_invokerWaiting = invokerWaiting; }
+    /// Get the delegate that invokes the message.
+    /// @return The delegate, or `nullptr` if not set.
+    virtual const DelegateBase* GetDelegate() const override { return m_delegate; }
 
 private:
-    /// An empty starting tuple
-    std::tuple<> m_start;
-
     /// A tuple with each function argument element 
     std::tuple<Args...> m_args;
 
-    /// Semaphore to signal waiting thread
-    Semaphore m_sema;
+    /// The target function return value, if any
+    RetSlot m_retVal;
 
-    /// Lock to protect shared data 
-    std::mutex m_lock;                       
+    /// Completion state shared between the source and destination threads
+    Completion m_completion;
 
-    /// True if source thread is waiting for destination thread invoke to complete
-    bool m_invokerWaiting = false;          
+    /// The invoker delegate kept alive by the base class invoker instance
+    const DelegateBase* m_delegate = nullptr;
 };
 
 template <class R>
@@ -139,7 +155,7 @@ public:
     /// invoke the target function. 
     DelegateFreeAsyncWait(FreeFunc func, DelegateThread& thread, std::chrono::milliseconds timeout = WAIT_INFINITE) :
         BaseType(func), m_thread(&thread), m_timeout(timeout) {
-        Bind(func, thread);
+        Bind(func, thread, timeout);
     }
 
     /// @brief Copy constructor that creates a copy of the given instance.
@@ -155,7 +171,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFreeAsyncWait(ClassType&& rhs) noexcept :
-        BaseType(rhs), m_thread(rhs.m_thread), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(rhs), m_thread(rhs.m_thread), m_timeout(rhs.m_timeout), m_success(rhs.m_success.load()), m_spin(rhs.m_spin), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -184,8 +200,9 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_timeout = rhs.m_timeout;
-        m_success = rhs.m_success;
-        m_retVal = rhs.m_retVal;
+        m_priority = rhs.m_priority;
+        m_success = rhs.m_success.load();
+        m_spin = rhs.m_spin;
         BaseType::Assign(rhs);
     }
 
@@ -199,6 +216,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -218,8 +255,9 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_timeout = rhs.m_timeout;    
-            m_success = rhs.m_success;
-            m_retVal = rhs.m_retVal;
+            m_priority = rhs.m_priority;
+            m_success = rhs.m_success.load();
+            m_spin = rhs.m_spin;
         }
         return *this;
     }
@@ -233,13 +271,20 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_thread == derivedRhs->m_thread &&
             m_timeout == derivedRhs->m_timeout &&
             BaseType::Equal(rhs);
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the bound target function and destination thread.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(BaseType::Hash(), std::hash<const void*>()(m_thread));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -284,58 +329,30 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicated and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The destination thread claims 
+    /// the call before invoking the target function, so a source thread timeout either abandons an 
+    /// unclaimed call or waits for a claimed call to complete.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
     virtual RetType operator()(Args... args) override {
-        if (this->Empty())
-            return RetType();
-
         // Synchronously invoke the target function?
-        if (m_sync) {
+        if (m_sync && !this->Empty()) {
             // Invoke the target function directly
             return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = std::make_shared<DelegateAsyncWaitMsg<Args...>>(delegate, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
-
-                // Wait for destination thread to execute the delegate function and get return value
-                if ((m_success = msg->GetSema().Wait(m_timeout)))
-                    m_retVal = delegate->m_retVal;
-            }
+        }
+
+        auto msg = AsyncCall(std::forward<Args>(args)...);
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType{};
-                }
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (msg && msg->GetRetVal().has_value()) {
+                // Move the destination thread target function return value to the caller
+                return std::move(*msg->GetRetVal());
+            } else {
+                // Return a default return value
+                return RetType{};
             }
         }
     }
@@ -348,20 +365,27 @@ public:
     /// the target function return value.
     auto AsyncInvoke(Args... args) {
         if constexpr (std::is_void<RetType>::value == true) {
-            operator()(args...);
-            return IsSuccess() ? std::optional<bool>(true) : std::optional<bool>();
+            if (m_sync && !this->Empty()) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return std::optional<bool>(true);
+            }
+            auto msg = AsyncCall(std::forward<Args>(args)...);
+            return msg ? std::optional<bool>(true) : std::optional<bool>();
         } else {
-            auto retVal = operator()(args...);
-            return IsSuccess() ? std::optional<RetType>(retVal) : std::optional<RetType>();
+            if (m_sync && !this->Empty())
+                return std::optional<RetType>(BaseType::operator()(std::forward<Args>(args)...));
+            auto msg = AsyncCall(std::forward<Args>(args)...);
+            return (msg && msg->GetRetVal().has_value()) ? 
+                std::optional<RetType>(std::move(*msg->GetRetVal())) : std::optional<RetType>();
         }
     }
 
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The destination thread claims the call with a single atomic 
+    /// compare-and-swap and signals the source thread when the target function call completes. 
+    /// The source thread is only woken if it is blocked waiting.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
@@ -369,17 +393,15 @@ public:
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
     virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
+        static_assert(!(std::is_reference<RetType>::value), "Reference return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = DelegateMsgCast<DelegateAsyncWaitMsg<RetType, Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        // Claim the call unless the source thread timeout expired and abandoned it
+        if (delegateMsg->GetCompletion().TryStart()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -389,51 +411,104 @@ public:
                 std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
             } else {
                 // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+                // and construct the return value in place within the message slot
+                delegateMsg->GetRetVal().emplace(std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs())));
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->GetCompletion().Complete();
         }
         return true;
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
-    /// @return `true` if the target asynchronous function call succeeded. `false` if 
-    /// the timeout expired before the target function could be invoked.
-    bool IsSuccess() noexcept { return m_success; }
-
-    /// Get the asynchronous function return value
-    /// @return The destination thraed target function return value
-    RetType GetRetVal() noexcept {
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
-            return RetType{};  // Return a default value if error
-        }
-    }
+    /// @return `true` if the most recent target asynchronous function call succeeded. `false` 
+    /// if the timeout expired before the target function could be invoked.
+    bool IsSuccess() noexcept { return m_success.load(); }
 
     ///@brief Get the destination thread that the target function is invoked on.
     // @return The target thread.
-    DelegateThread* GetThread() noexcept { return m_thread; }
+    DelegateThread* GetThread() const noexcept { return m_thread; }
+
+    /// @brief Set the source thread busy wait phase used before blocking on the 
+    /// destination thread. Spinning reduces round trip latency of short target 
+    /// functions at the cost of source thread CPU time.
+    /// @param[in] spin The spin and yield iterations. Defaults to `SpinPolicy::Default()`.
+    void SetSpinPolicy(const SpinPolicy& spin) noexcept { m_spin = spin; }
+
+    /// @brief Get the source thread busy wait phase.
+    /// @return The spin policy.
+    const SpinPolicy& GetSpinPolicy() const noexcept { return m_spin; }
+
+    /// @brief Set the dispatch priority of messages sent to the destination thread.
+    /// @param[in] priority The dispatch priority. Defaults to `DelegatePriority::NORMAL`.
+    void SetPriority(DelegatePriority priority) noexcept { m_priority = priority; }
+
+    /// @brief Get the dispatch priority of messages sent to the destination thread.
+    /// @return The dispatch priority.
+    DelegatePriority GetPriority() const noexcept { return m_priority; }
 
 private:
+    /// @brief Dispatch the call to the destination thread and block for completion.
+    /// @details Shared by `operator()` and `AsyncInvoke()`. The outcome is returned per call 
+    /// so concurrent callers sharing this instance, such as `MulticastDelegateSafe` broadcasts, 
+    /// never observe another caller's result. `m_success` only records the most recent call.
+    /// @param[in] args The function arguments, if any.
+    /// @return The completed message holding the return value slot, or `nullptr` if the 
+    /// delegate is empty or the timeout expired before the target function was invoked.
+    std::shared_ptr<DelegateAsyncWaitMsg<RetType, Args...>> AsyncCall(Args... args) {
+        if (this->Empty())
+            return nullptr;
+
+        // Create a clone instance of this delegate 
+        auto delegate = std::shared_ptr<ClassType>(Clone());
+        if (!delegate)
+            BAD_ALLOC();
+
+        // Create a new message instance for sending to the destination thread.
+        auto msg = std::make_shared<DelegateAsyncWaitMsg<RetType, Args...>>(delegate, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+        msg->SetPriority(m_priority);
+        if (m_timeout != WAIT_INFINITE)
+            msg->SetDeadline(std::chrono::steady_clock::now() + m_timeout);
+        DelegateThread::TraceSend(*msg);
+        msg->SetDelegate(delegate.get());
+
+        // Per-call result so concurrent callers sharing this instance do not race
+        bool success = false;
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            thread->DispatchDelegate(msg);
+
+            // Wait for destination thread to execute the delegate function. The call is 
+            // abandoned if the timeout expires before the destination claims it.
+            success = msg->GetCompletion().Wait(m_timeout, m_spin);
+        }
+        m_success = success;
+        return success ? msg : nullptr;
+    }
+
     /// The target thread to invoke the delegate function.
     DelegateThread* m_thread = nullptr;
 
     /// Flag to control synchronous vs asynchronous target invoke behavior.
     bool m_sync = false;
 
-    /// Set to `true` if async function call succeeds
-    bool m_success = false;			        
+    /// Set to `true` if the most recent async function call succeeds. Atomic since 
+    /// concurrent callers, such as `MulticastDelegateSafe` broadcasts, share this instance.
+    std::atomic<bool> m_success = false;			        
 
     /// Time in mS to wait for async function to invoke
     std::chrono::milliseconds m_timeout = WAIT_INFINITE;    
 
-    /// Return value of the target invoked function
-    std::any m_retVal;                      
+    /// Source thread busy wait phase before blocking
+    SpinPolicy m_spin = SpinPolicy::Default();
+
+    /// The dispatch priority of messages sent to the destination thread
+    DelegatePriority m_priority = DelegatePriority::NORMAL;
 
     // </common_code>
 };
@@ -463,7 +538,7 @@ public:
     /// invoke the target function. 
     DelegateMemberAsyncWait(SharedPtr object, MemberFunc func, DelegateThread& thread, std::chrono::milliseconds timeout = WAIT_INFINITE) :
         BaseType(object, func), m_thread(&thread), m_timeout(timeout) {
-        Bind(object, func, thread);
+        Bind(object, func, thread, timeout);
     }
 
     /// @brief Constructor to create a class instance.
@@ -474,7 +549,7 @@ public:
     /// invoke the target function. 
     DelegateMemberAsyncWait(SharedPtr object, ConstMemberFunc func, DelegateThread& thread, std::chrono::milliseconds timeout) :
         BaseType(object, func), m_thread(&thread), m_timeout(timeout) {
-        Bind(object, func, thread);
+        Bind(object, func, thread, timeout);
     }
 
     /// @brief Constructor to create a class instance.
@@ -485,7 +560,7 @@ public:
     /// invoke the target function. 
     DelegateMemberAsyncWait(ObjectPtr object, MemberFunc func, DelegateThread& thread, std::chrono::milliseconds timeout = WAIT_INFINITE) :
         BaseType(object, func), m_thread(&thread), m_timeout(timeout) {
-        Bind(object, func, thread);
+        Bind(object, func, thread, timeout);
     }
 
     /// @brief Constructor to create a class instance.
@@ -496,7 +571,7 @@ public:
     /// invoke the target function. 
     DelegateMemberAsyncWait(ObjectPtr object, ConstMemberFunc func, DelegateThread& thread, std::chrono::milliseconds timeout) :
         BaseType(object, func), m_thread(&thread), m_timeout(timeout) {
-        Bind(object, func, thread);
+        Bind(object, func, thread, timeout);
     }
 
     /// @brief Copy constructor that creates a copy of the given instance.
@@ -512,7 +587,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateMemberAsyncWait(ClassType&& rhs) noexcept :
-        BaseType(rhs), m_thread(rhs.m_thread), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(rhs), m_thread(rhs.m_thread), m_timeout(rhs.m_timeout), m_success(rhs.m_success.load()), m_spin(rhs.m_spin), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -587,8 +662,9 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_timeout = rhs.m_timeout;
-        m_success = rhs.m_success;
-        m_retVal = rhs.m_retVal;
+        m_priority = rhs.m_priority;
+        m_success = rhs.m_success.load();
+        m_spin = rhs.m_spin;
         BaseType::Assign(rhs);
     }
 
@@ -602,6 +678,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -621,8 +717,9 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_timeout = rhs.m_timeout;    
-            m_success = rhs.m_success;
-            m_retVal = rhs.m_retVal;
+            m_priority = rhs.m_priority;
+            m_success = rhs.m_success.load();
+            m_spin = rhs.m_spin;
         }
         return *this;
     }
@@ -636,13 +733,20 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_thread == derivedRhs->m_thread &&
             m_timeout == derivedRhs->m_timeout &&
             BaseType::Equal(rhs);
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the bound target function and destination thread.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(BaseType::Hash(), std::hash<const void*>()(m_thread));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -687,58 +791,30 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicated and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The destination thread claims 
+    /// the call before invoking the target function, so a source thread timeout either abandons an 
+    /// unclaimed call or waits for a claimed call to complete.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
     virtual RetType operator()(Args... args) override {
-        if (this->Empty())
-            return RetType();
-
         // Synchronously invoke the target function?
-        if (m_sync) {
+        if (m_sync && !this->Empty()) {
             // Invoke the target function directly
             return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = std::make_shared<DelegateAsyncWaitMsg<Args...>>(delegate, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
-
-                // Wait for destination thread to execute the delegate function and get return value
-                if ((m_success = msg->GetSema().Wait(m_timeout)))
-                    m_retVal = delegate->m_retVal;
-            }
+        }
+
+        auto msg = AsyncCall(std::forward<Args>(args)...);
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType{};
-                }
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (msg && msg->GetRetVal().has_value()) {
+                // Move the destination thread target function return value to the caller
+                return std::move(*msg->GetRetVal());
+            } else {
+                // Return a default return value
+                return RetType{};
             }
         }
     }
@@ -751,20 +827,27 @@ public:
     /// the target function return value.
     auto AsyncInvoke(Args... args) {
         if constexpr (std::is_void<RetType>::value == true) {
-            operator()(args...);
-            return IsSuccess() ? std::optional<bool>(true) : std::optional<bool>();
+            if (m_sync && !this->Empty()) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return std::optional<bool>(true);
+            }
+            auto msg = AsyncCall(std::forward<Args>(args)...);
+            return msg ? std::optional<bool>(true) : std::optional<bool>();
         } else {
-            auto retVal = operator()(args...);
-            return IsSuccess() ? std::optional<RetType>(retVal) : std::optional<RetType>();
+            if (m_sync && !this->Empty())
+                return std::optional<RetType>(BaseType::operator()(std::forward<Args>(args)...));
+            auto msg = AsyncCall(std::forward<Args>(args)...);
+            return (msg && msg->GetRetVal().has_value()) ? 
+                std::optional<RetType>(std::move(*msg->GetRetVal())) : std::optional<RetType>();
         }
     }
 
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The destination thread claims the call with a single atomic 
+    /// compare-and-swap and signals the source thread when the target function call completes. 
+    /// The source thread is only woken if it is blocked waiting.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
@@ -772,17 +855,15 @@ public:
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
     virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
+        static_assert(!(std::is_reference<RetType>::value), "Reference return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = DelegateMsgCast<DelegateAsyncWaitMsg<RetType, Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        // Claim the call unless the source thread timeout expired and abandoned it
+        if (delegateMsg->GetCompletion().TryStart()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -792,51 +873,104 @@ public:
                 std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
             } else {
                 // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+                // and construct the return value in place within the message slot
+                delegateMsg->GetRetVal().emplace(std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs())));
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->GetCompletion().Complete();
         }
         return true;
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
-    /// @return `true` if the target asynchronous function call succeeded. `false` if 
-    /// the timeout expired before the target function could be invoked.
-    bool IsSuccess() noexcept { return m_success; }
-
-    /// Get the asynchronous function return value
-    /// @return The destination thraed target function return value
-    RetType GetRetVal() noexcept {
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
-            return RetType{};  // Return a default value if error
-        }
-    }
+    /// @return `true` if the most recent target asynchronous function call succeeded. `false` 
+    /// if the timeout expired before the target function could be invoked.
+    bool IsSuccess() noexcept { return m_success.load(); }
 
     ///@brief Get the destination thread that the target function is invoked on.
     // @return The target thread.
-    DelegateThread* GetThread() noexcept { return m_thread; }
+    DelegateThread* GetThread() const noexcept { return m_thread; }
+
+    /// @brief Set the source thread busy wait phase used before blocking on the 
+    /// destination thread. Spinning reduces round trip latency of short target 
+    /// functions at the cost of source thread CPU time.
+    /// @param[in] spin The spin and yield iterations. Defaults to `SpinPolicy::Default()`.
+    void SetSpinPolicy(const SpinPolicy& spin) noexcept { m_spin = spin; }
+
+    /// @brief Get the source thread busy wait phase.
+    /// @return The spin policy.
+    const SpinPolicy& GetSpinPolicy() const noexcept { return m_spin; }
+
+    /// @brief Set the dispatch priority of messages sent to the destination thread.
+    /// @param[in] priority The dispatch priority. Defaults to `DelegatePriority::NORMAL`.
+    void SetPriority(DelegatePriority priority) noexcept { m_priority = priority; }
+
+    /// @brief Get the dispatch priority of messages sent to the destination thread.
+    /// @return The dispatch priority.
+    DelegatePriority GetPriority() const noexcept { return m_priority; }
 
 private:
+    /// @brief Dispatch the call to the destination thread and block for completion.
+    /// @details Shared by `operator()` and `AsyncInvoke()`. The outcome is returned per call 
+    /// so concurrent callers sharing this instance, such as `MulticastDelegateSafe` broadcasts, 
+    /// never observe another caller's result. `m_success` only records the most recent call.
+    /// @param[in] args The function arguments, if any.
+    /// @return The completed message holding the return value slot, or `nullptr` if the 
+    /// delegate is empty or the timeout expired before the target function was invoked.
+    std::shared_ptr<DelegateAsyncWaitMsg<RetType, Args...>> AsyncCall(Args... args) {
+        if (this->Empty())
+            return nullptr;
+
+        // Create a clone instance of this delegate 
+        auto delegate = std::shared_ptr<ClassType>(Clone());
+        if (!delegate)
+            BAD_ALLOC();
+
+        // Create a new message instance for sending to the destination thread.
+        auto msg = std::make_shared<DelegateAsyncWaitMsg<RetType, Args...>>(delegate, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+        msg->SetPriority(m_priority);
+        if (m_timeout != WAIT_INFINITE)
+            msg->SetDeadline(std::chrono::steady_clock::now() + m_timeout);
+        DelegateThread::TraceSend(*msg);
+        msg->SetDelegate(delegate.get());
+
+        // Per-call result so concurrent callers sharing this instance do not race
+        bool success = false;
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            thread->DispatchDelegate(msg);
+
+            // Wait for destination thread to execute the delegate function. The call is 
+            // abandoned if the timeout expires before the destination claims it.
+            success = msg->GetCompletion().Wait(m_timeout, m_spin);
+        }
+        m_success = success;
+        return success ? msg : nullptr;
+    }
+
     /// The target thread to invoke the delegate function.
     DelegateThread* m_thread = nullptr;
 
     /// Flag to control synchronous vs asynchronous target invoke behavior.
     bool m_sync = false;
 
-    /// Set to `true` if async function call succeeds
-    bool m_success = false;			        
+    /// Set to `true` if the most recent async function call succeeds. Atomic since 
+    /// concurrent callers, such as `MulticastDelegateSafe` broadcasts, share this instance.
+    std::atomic<bool> m_success = false;			        
 
     /// Time in mS to wait for async function to invoke
     std::chrono::milliseconds m_timeout = WAIT_INFINITE;    
 
-    /// Return value of the target invoked function
-    std::any m_retVal;                      
+    /// Source thread busy wait phase before blocking
+    SpinPolicy m_spin = SpinPolicy::Default();
+
+    /// The dispatch priority of messages sent to the destination thread
+    DelegatePriority m_priority = DelegatePriority::NORMAL;
 
     // </common_code>
 };
@@ -864,7 +998,7 @@ public:
     /// invoke the target function. 
     DelegateFunctionAsyncWait(FunctionType func, DelegateThread& thread, std::chrono::milliseconds timeout = WAIT_INFINITE) :
         BaseType(func), m_thread(&thread), m_timeout(timeout) {
-        Bind(func, thread);
+        Bind(func, thread, timeout);
     }
 
     /// @brief Copy constructor that creates a copy of the given instance.
@@ -880,7 +1014,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFunctionAsyncWait(ClassType&& rhs) noexcept :
-        BaseType(rhs), m_thread(rhs.m_thread), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(rhs), m_thread(rhs.m_thread), m_timeout(rhs.m_timeout), m_success(rhs.m_success.load()), m_spin(rhs.m_spin), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -909,8 +1043,9 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_timeout = rhs.m_timeout;
-        m_success = rhs.m_success;
-        m_retVal = rhs.m_retVal;
+        m_priority = rhs.m_priority;
+        m_success = rhs.m_success.load();
+        m_spin = rhs.m_spin;
         BaseType::Assign(rhs);
     }
 
@@ -924,6 +1059,26 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @details Used by containers to store a delegate inline without dynamic 
+    /// storage allocation. 
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr` 
+    /// if the copy does not fit. 
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -943,8 +1098,9 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_timeout = rhs.m_timeout;    
-            m_success = rhs.m_success;
-            m_retVal = rhs.m_retVal;
+            m_priority = rhs.m_priority;
+            m_success = rhs.m_success.load();
+            m_spin = rhs.m_spin;
         }
         return *this;
     }
@@ -958,13 +1114,20 @@ public:
     /// @param[in] rhs The `DelegateBase` object to compare with the current object.
     /// @return `true` if the two delegate objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& rhs) const override {
-        auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
         return derivedRhs &&
             m_thread == derivedRhs->m_thread &&
             m_timeout == derivedRhs->m_timeout &&
             BaseType::Equal(rhs);
     }
 
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the bound target function and destination thread.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateHashCombine(BaseType::Hash(), std::hash<const void*>()(m_thread));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -1009,58 +1172,30 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicated and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The destination thread claims 
+    /// the call before invoking the target function, so a source thread timeout either abandons an 
+    /// unclaimed call or waits for a claimed call to complete.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
     virtual RetType operator()(Args... args) override {
-        if (this->Empty())
-            return RetType();
-
         // Synchronously invoke the target function?
-        if (m_sync) {
+        if (m_sync && !this->Empty()) {
             // Invoke the target function directly
             return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = std::make_shared<DelegateAsyncWaitMsg<Args...>>(delegate, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
-
-                // Wait for destination thread to execute the delegate function and get return value
-                if ((m_success = msg->GetSema().Wait(m_timeout)))
-                    m_retVal = delegate->m_retVal;
-            }
+        }
+
+        auto msg = AsyncCall(std::forward<Args>(args)...);
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType{};
-                }
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (msg && msg->GetRetVal().has_value()) {
+                // Move the destination thread target function return value to the caller
+                return std::move(*msg->GetRetVal());
+            } else {
+                // Return a default return value
+                return RetType{};
             }
         }
     }
@@ -1073,20 +1208,27 @@ public:
     /// the target function return value.
     auto AsyncInvoke(Args... args) {
         if constexpr (std::is_void<RetType>::value == true) {
-            operator()(args...);
-            return IsSuccess() ? std::optional<bool>(true) : std::optional<bool>();
+            if (m_sync && !this->Empty()) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return std::optional<bool>(true);
+            }
+            auto msg = AsyncCall(std::forward<Args>(args)...);
+            return msg ? std::optional<bool>(true) : std::optional<bool>();
         } else {
-            auto retVal = operator()(args...);
-            return IsSuccess() ? std::optional<RetType>(retVal) : std::optional<RetType>();
+            if (m_sync && !this->Empty())
+                return std::optional<RetType>(BaseType::operator()(std::forward<Args>(args)...));
+            auto msg = AsyncCall(std::forward<Args>(args)...);
+            return (msg && msg->GetRetVal().has_value()) ? 
+                std::optional<RetType>(std::move(*msg->GetRetVal())) : std::optional<RetType>();
         }
     }
 
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The destination thread claims the call with a single atomic 
+    /// compare-and-swap and signals the source thread when the target function call completes. 
+    /// The source thread is only woken if it is blocked waiting.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
@@ -1094,17 +1236,15 @@ public:
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
     virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
+        static_assert(!(std::is_reference<RetType>::value), "Reference return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = DelegateMsgCast<DelegateAsyncWaitMsg<RetType, Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        // Claim the call unless the source thread timeout expired and abandoned it
+        if (delegateMsg->GetCompletion().TryStart()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -1114,51 +1254,104 @@ public:
                 std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
             } else {
                 // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+                // and construct the return value in place within the message slot
+                delegateMsg->GetRetVal().emplace(std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs())));
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->GetCompletion().Complete();
         }
         return true;
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
-    /// @return `true` if the target asynchronous function call succeeded. `false` if 
-    /// the timeout expired before the target function could be invoked.
-    bool IsSuccess() noexcept { return m_success; }
-
-    /// Get the asynchronous function return value
-    /// @return The destination thraed target function return value
-    RetType GetRetVal() noexcept {
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
-            return RetType{};  // Return a default value if error
-        }
-    }
+    /// @return `true` if the most recent target asynchronous function call succeeded. `false` 
+    /// if the timeout expired before the target function could be invoked.
+    bool IsSuccess() noexcept { return m_success.load(); }
 
     ///@brief Get the destination thread that the target function is invoked on.
     // @return The target thread.
-    DelegateThread* GetThread() noexcept { return m_thread; }
+    DelegateThread* GetThread() const noexcept { return m_thread; }
+
+    /// @brief Set the source thread busy wait phase used before blocking on the 
+    /// destination thread. Spinning reduces round trip latency of short target 
+    /// functions at the cost of source thread CPU time.
+    /// @param[in] spin The spin and yield iterations. Defaults to `SpinPolicy::Default()`.
+    void SetSpinPolicy(const SpinPolicy& spin) noexcept { m_spin = spin; }
+
+    /// @brief Get the source thread busy wait phase.
+    /// @return The spin policy.
+    const SpinPolicy& GetSpinPolicy() const noexcept { return m_spin; }
+
+    /// @brief Set the dispatch priority of messages sent to the destination thread.
+    /// @param[in] priority The dispatch priority. Defaults to `DelegatePriority::NORMAL`.
+    void SetPriority(DelegatePriority priority) noexcept { m_priority = priority; }
+
+    /// @brief Get the dispatch priority of messages sent to the destination thread.
+    /// @return The dispatch priority.
+    DelegatePriority GetPriority() const noexcept { return m_priority; }
 
 private:
+    /// @brief Dispatch the call to the destination thread and block for completion.
+    /// @details Shared by `operator()` and `AsyncInvoke()`. The outcome is returned per call 
+    /// so concurrent callers sharing this instance, such as `MulticastDelegateSafe` broadcasts, 
+    /// never observe another caller's result. `m_success` only records the most recent call.
+    /// @param[in] args The function arguments, if any.
+    /// @return The completed message holding the return value slot, or `nullptr` if the 
+    /// delegate is empty or the timeout expired before the target function was invoked.
+    std::shared_ptr<DelegateAsyncWaitMsg<RetType, Args...>> AsyncCall(Args... args) {
+        if (this->Empty())
+            return nullptr;
+
+        // Create a clone instance of this delegate 
+        auto delegate = std::shared_ptr<ClassType>(Clone());
+        if (!delegate)
+            BAD_ALLOC();
+
+        // Create a new message instance for sending to the destination thread.
+        auto msg = std::make_shared<DelegateAsyncWaitMsg<RetType, Args...>>(delegate, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+        msg->SetPriority(m_priority);
+        if (m_timeout != WAIT_INFINITE)
+            msg->SetDeadline(std::chrono::steady_clock::now() + m_timeout);
+        DelegateThread::TraceSend(*msg);
+        msg->SetDelegate(delegate.get());
+
+        // Per-call result so concurrent callers sharing this instance do not race
+        bool success = false;
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            thread->DispatchDelegate(msg);
+
+            // Wait for destination thread to execute the delegate function. The call is 
+            // abandoned if the timeout expires before the destination claims it.
+            success = msg->GetCompletion().Wait(m_timeout, m_spin);
+        }
+        m_success = success;
+        return success ? msg : nullptr;
+    }
+
     /// The target thread to invoke the delegate function.
     DelegateThread* m_thread = nullptr;
 
     /// Flag to control synchronous vs asynchronous target invoke behavior.
     bool m_sync = false;
 
-    /// Set to `true` if async function call succeeds
-    bool m_success = false;			        
+    /// Set to `true` if the most recent async function call succeeds. Atomic since 
+    /// concurrent callers, such as `MulticastDelegateSafe` broadcasts, share this instance.
+    std::atomic<bool> m_success = false;			        
 
     /// Time in mS to wait for async function to invoke
     std::chrono::milliseconds m_timeout = WAIT_INFINITE;    
 
-    /// Return value of the target invoked function
-    std::any m_retVal;                      
+    /// Source thread busy wait phase before blocking
+    SpinPolicy m_spin = SpinPolicy::Default();
+
+    /// The dispatch priority of messages sent to the destination thread
+    DelegatePriority m_priority = DelegatePriority::NORMAL;
 
     // </common_code>
 };
@@ -1169,10 +1362,13 @@ private:
 /// @param[in] func A pointer to the free function to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateFreeAsyncWait` object bound to the specified free function, thread, and timeout.
 template <class RetType, class... Args>
-auto MakeDelegate(RetType(*func)(Args... args), DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateFreeAsyncWait<RetType(Args...)>(func, thread, timeout);
+auto MakeDelegate(RetType(*func)(Args... args), DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateFreeAsyncWait<RetType(Args...)>(func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a non-const member function with a wait and timeout.
@@ -1183,10 +1379,13 @@ auto MakeDelegate(RetType(*func)(Args... args), DelegateThread& thread, std::chr
 /// @param[in] func A pointer to the non-const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsyncWait` object bound to the specified non-const member function, thread, and timeout.
 template <class TClass, class RetType, class... Args>
-auto MakeDelegate(TClass* object, RetType(TClass::*func)(Args... args), DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateMemberAsyncWait<TClass, RetType(Args...)>(object, func, thread, timeout);
+auto MakeDelegate(TClass* object, RetType(TClass::*func)(Args... args), DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsyncWait<TClass, RetType(Args...)>(object, func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a const member function with a wait and timeout.
@@ -1197,10 +1396,13 @@ auto MakeDelegate(TClass* object, RetType(TClass::*func)(Args... args), Delegate
 /// @param[in] func A pointer to the const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsyncWait` object bound to the specified const member function, thread, and timeout.
 template <class TClass, class RetType, class... Args>
-auto MakeDelegate(TClass* object, RetType(TClass::*func)(Args... args) const, DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateMemberAsyncWait<TClass, RetType(Args...)>(object, func, thread, timeout);
+auto MakeDelegate(TClass* object, RetType(TClass::*func)(Args... args) const, DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsyncWait<TClass, RetType(Args...)>(object, func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates a delegate that binds to a const member function.
@@ -1211,10 +1413,13 @@ auto MakeDelegate(TClass* object, RetType(TClass::*func)(Args... args) const, De
 /// @param[in] func A pointer to the non-const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsyncWait` object bound to the specified non-const member function.
 template <class TClass, class RetType, class... Args>
-auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args... args) const, DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateMemberAsyncWait<const TClass, RetType(Args...)>(object, func, thread, timeout);
+auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args... args) const, DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsyncWait<const TClass, RetType(Args...)>(object, func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 
@@ -1226,10 +1431,13 @@ auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args... args) co
 /// @param[in] func A pointer to the non-const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsyncWait` shared pointer bound to the specified non-const member function, thread, and timeout.
 template <class TClass, class RetVal, class... Args>
-auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args), DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateMemberAsyncWait<TClass, RetVal(Args...)>(object, func, thread, timeout);
+auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args), DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsyncWait<TClass, RetVal(Args...)>(object, func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a const member function using a shared pointer, with a wait and timeout.
@@ -1240,10 +1448,13 @@ auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args...
 /// @param[in] func A pointer to the const member function of `TClass` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateMemberAsyncWait` shared pointer bound to the specified const member function, thread, and timeout.
 template <class TClass, class RetVal, class... Args>
-auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args) const, DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateMemberAsyncWait<TClass, RetVal(Args...)>(object, func, thread, timeout);
+auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args... args) const, DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateMemberAsyncWait<TClass, RetVal(Args...)>(object, func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 /// @brief Creates an asynchronous delegate that binds to a `std::function` with a wait and timeout.
@@ -1252,10 +1463,13 @@ auto MakeDelegate(std::shared_ptr<TClass> object, RetVal(TClass::* func)(Args...
 /// @param[in] func The `std::function` to bind to the delegate.
 /// @param[in] thread The `DelegateThread` on which the function will be invoked asynchronously.
 /// @param[in] timeout The duration to wait for the function to complete before returning.
+/// @param[in] priority The dispatch priority of messages sent to `thread`.
 /// @return A `DelegateFunctionAsyncWait` object bound to the specified `std::function`, thread, and timeout.
 template <class RetType, class... Args>
-auto MakeDelegate(std::function<RetType(Args...)> func, DelegateThread& thread, std::chrono::milliseconds timeout) {
-    return DelegateFunctionAsyncWait<RetType(Args...)>(func, thread, timeout);
+auto MakeDelegate(std::function<RetType(Args...)> func, DelegateThread& thread, std::chrono::milliseconds timeout, DelegatePriority priority = DelegatePriority::NORMAL) {
+    auto delegate = DelegateFunctionAsyncWait<RetType(Args...)>(func, thread, timeout);
+    delegate.SetPriority(priority);
+    return delegate;
 }
 
 } 
@@ -0,0 +1,195 @@
+#ifndef _DELEGATE_AWAIT_H
+#define _DELEGATE_AWAIT_H
+
+/// @file
+/// @brief C++20 coroutine awaitable for asynchronous delegates.
+///
+/// @details `AsyncAwait()` creates an awaitable from an asynchronous delegate. Awaiting
+/// suspends the calling coroutine and dispatches the target function onto the delegate
+/// destination thread using `DelegateThread::DispatchDelegate()`. Once the target function
+/// returns, the destination thread dispatches the coroutine resumption back onto the
+/// caller's `DelegateThread`. No thread blocks waiting and no semaphore is used.
+///
+/// @code
+/// auto delegate = MakeDelegate(&object, &MyClass::Func, destinationThread, WAIT_INFINITE);
+/// int retVal = co_await AsyncAwait(delegate, 123);
+/// @endcode
+///
+/// The coroutine resumes on `DelegateThread::GetCurrent()` at the point of suspension,
+/// or on the thread passed to `AsyncAwaitOn()`. If the caller is not executing on a
+/// delegate thread, the coroutine resumes on the destination thread.
+///
+/// The function arguments are stored within the awaitable, which lives in the suspended
+/// coroutine frame, so no heap copy is made. Pointer and non-const reference arguments are
+/// shared with the destination thread like `DelegateAsyncWait`. Const reference arguments 
+/// are copied into the awaitable since the caller may pass a temporary. Await the result 
+/// within the same expression that calls `AsyncAwait()`. If the destination thread exits 
+/// with the call queued, the coroutine is never resumed.
+///
+/// Requires C++20. Empty when compiled with an earlier language standard.
+
+#if defined(_MSVC_LANG) && _MSVC_LANG >= 202002L || __cplusplus >= 202002L
+
+#include "Delegate.h"
+#include "DelegateThread.h"
+#include "DelegateInvoker.h"
+#include "DelegateMsg.h"
+#include <coroutine>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+namespace DelegateLib {
+
+/// @brief The awaitable argument storage type. A const reference argument is stored 
+/// by value, all other arguments are stored as declared.
+template <class Arg>
+using DelegateAwaitArg = std::conditional_t<std::is_lvalue_reference<Arg>::value && 
+    std::is_const<std::remove_reference_t<Arg>>::value, std::decay_t<Arg>, Arg>;
+
+/// @brief Awaitable returned by `AsyncAwait()`. Invokes the target function on the
+/// destination thread and resumes the awaiting coroutine on the resume thread.
+/// @tparam TTarget The synchronous delegate type invoked on the destination thread.
+/// @tparam RetType The return type of the bound delegate function.
+/// @tparam Args The argument types of the bound delegate function.
+template <class TTarget, class RetType, class... Args>
+class DelegateAwaitable : public IDelegateInvoker
+{
+public:
+    /// Constructor
+    /// @param[in] target - the synchronous delegate invoked on the destination thread.
+    /// @param[in] thread - the destination thread.
+    /// @param[in] resumeThread - the thread to resume the coroutine on, or `nullptr` to
+    /// resume on the current delegate thread.
+    /// @param[in] args - the target function arguments.
+    template <class... A>
+    DelegateAwaitable(const TTarget& target, DelegateThread* thread, DelegateThread* resumeThread, A&&... args) :
+        m_target(target), m_thread(thread), m_resumeThread(resumeThread), m_args(std::forward<A>(args)...) {}
+
+    DelegateAwaitable(DelegateAwaitable&&) = default;
+
+    /// Never ready. The target function always executes on the destination thread.
+    bool await_ready() const noexcept { return false; }
+
+    /// Dispatch the target function onto the destination thread.
+    /// @param[in] handle - the awaiting coroutine.
+    /// @return `false` to resume immediately if the delegate is empty or unbound.
+    bool await_suspend(std::coroutine_handle<> handle) {
+        if (m_target.Empty() || !m_thread)
+            return false;
+
+        m_handle = handle;
+        if (!m_resumeThread)
+            m_resumeThread = DelegateThread::GetCurrent();
+
+        // The awaitable lives within the suspended coroutine frame, so the message
+        // does not own the invoker
+        auto msg = xmake_shared<DelegateMsg>(std::shared_ptr<IDelegateInvoker>(std::shared_ptr<IDelegateInvoker>(), this));
+        if (!msg)
+            BAD_ALLOC();
+        m_thread->DispatchDelegate(msg);
+        return true;
+    }
+
+    /// Get the target function return value once the coroutine resumes.
+    /// @return The target function return value, or a default value if the delegate is empty.
+    RetType await_resume() {
+        if constexpr (std::is_void<RetType>::value == false) {
+            if (m_retVal.has_value())
+                return std::move(*m_retVal);
+            return RetType{};
+        }
+    }
+
+    /// Called by the destination thread to invoke the target function, then by the
+    /// resume thread to resume the coroutine.
+    /// @param[in] msg - the message created within `await_suspend()`.
+    /// @return `true` always.
+    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+        if (m_invoked) {
+            // Resume thread
+            m_handle.resume();
+            return true;
+        }
+
+        // Destination thread
+        if constexpr (std::is_void<RetType>::value == true) {
+            std::apply(m_target, m_args);
+        } else {
+            m_retVal.emplace(std::apply(m_target, m_args));
+        }
+        m_invoked = true;
+
+        if (m_resumeThread && m_resumeThread != m_thread)
+            m_resumeThread->DispatchDelegate(msg);
+        else
+            m_handle.resume();
+        return true;
+    }
+
+private:
+    // Prevent copying objects
+    DelegateAwaitable(const DelegateAwaitable&) = delete;
+    DelegateAwaitable& operator=(const DelegateAwaitable&) = delete;
+
+    /// The synchronous delegate invoked on the destination thread
+    TTarget m_target;
+
+    /// The destination thread
+    DelegateThread* m_thread = nullptr;
+
+    /// The thread to resume the awaiting coroutine on
+    DelegateThread* m_resumeThread = nullptr;
+
+    /// The function arguments
+    std::tuple<DelegateAwaitArg<Args>...> m_args;
+
+    /// The awaiting coroutine
+    std::coroutine_handle<> m_handle;
+
+    /// Set by the destination thread once the target function returns
+    bool m_invoked = false;
+
+    /// The target function return value, if any
+    std::optional<std::conditional_t<std::is_void<RetType>::value, bool, RetType>> m_retVal;
+};
+
+/// @cond INTERNAL
+template <class RetType, class... Args, class TTarget, class... A>
+auto MakeDelegateAwaitable(const Delegate<RetType(Args...)>*, const TTarget& target, 
+    DelegateThread* thread, DelegateThread* resumeThread, A&&... args) {
+    return DelegateAwaitable<TTarget, RetType, Args...>(target, thread, resumeThread, std::forward<A>(args)...);
+}
+/// @endcond
+
+/// @brief Create an awaitable that invokes the delegate target function on the delegate
+/// destination thread and resumes the awaiting coroutine on `resumeThread`.
+/// @tparam TDelegate Any asynchronous delegate type, e.g. `DelegateMemberAsyncWait`.
+/// @param[in] resumeThread - the thread to resume the coroutine on, or `nullptr` to
+/// resume on the current delegate thread.
+/// @param[in] delegate - the asynchronous delegate. Only the target function and thread are used.
+/// @param[in] args - the target function arguments.
+/// @return The awaitable. `co_await` yields the target function return value.
+template <class TDelegate, class... A>
+auto AsyncAwaitOn(DelegateThread* resumeThread, const TDelegate& delegate, A&&... args) {
+    using TTarget = typename TDelegate::BaseType;
+    const TTarget& target = delegate;
+    return MakeDelegateAwaitable(&target, target, delegate.GetThread(), resumeThread, std::forward<A>(args)...);
+}
+
+/// @brief Create an awaitable that invokes the delegate target function on the delegate
+/// destination thread and resumes the awaiting coroutine on the current delegate thread.
+/// @tparam TDelegate Any asynchronous delegate type, e.g. `DelegateMemberAsyncWait`.
+/// @param[in] delegate - the asynchronous delegate. Only the target function and thread are used.
+/// @param[in] args - the target function arguments.
+/// @return The awaitable. `co_await` yields the target function return value.
+template <class TDelegate, class... A>
+auto AsyncAwait(const TDelegate& delegate, A&&... args) {
+    return AsyncAwaitOn(nullptr, delegate, std::forward<A>(args)...);
+}
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef _DELEGATE_COALESCE_H
+#define _DELEGATE_COALESCE_H
+
+/// @file
+/// @brief Pending coalescing message table of a delegate destination thread.
+///
+/// @details A coalescing asynchronous delegate, see `SetCoalesce()` in `DelegateAsync.h`,
+/// keeps at most one pending message per target function and destination thread. Each
+/// `DelegateThread` owns a table of its pending coalescing messages keyed by the delegate
+/// `Hash()` and matched using `Equal()`. A source thread that finds a pending message
+/// updates the message arguments in place instead of dispatching another message. The
+/// destination thread removes the message from the table before invoking the target
+/// function, so a later call dispatches a new message.
+
+#include "Delegate.h"
+#include "DelegateMsg.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace DelegateLib {
+
+/// @brief Pending coalescing messages of one destination thread. All functions except
+/// `GetLock()` must be called with the table locked.
+class DelegateCoalesceTable
+{
+public:
+	DelegateCoalesceTable() = default;
+
+	/// Get the lock protecting the table and the arguments of each pending message.
+	/// @return The table lock.
+	std::mutex& GetLock() { return m_lock; }
+
+	/// Find the pending message bound to a delegate target function.
+	/// @param[in] delegate - the delegate to match using `Equal()`.
+	/// @return The pending message, or `nullptr` if none.
+	std::shared_ptr<DelegateMsg> Find(const DelegateBase& delegate) const
+	{
+		auto range = m_pending.equal_range(delegate.Hash());
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			const DelegateBase* pending = it->second->GetDelegate();
+			if (pending && pending->Equal(delegate))
+				return it->second;
+		}
+		return nullptr;
+	}
+
+	/// Add a pending message.
+	/// @param[in] msg - the dispatched message. `GetDelegate()` must not return `nullptr`.
+	void Add(std::shared_ptr<DelegateMsg> msg)
+	{
+		std::size_t hash = msg->GetDelegate()->Hash();
+		m_pending.emplace(hash, std::move(msg));
+	}
+
+	/// Remove a pending message.
+	/// @param[in] msg - the message to remove.
+	/// @return `true` if removed. `false` if the message is not pending.
+	bool Remove(const DelegateMsg* msg)
+	{
+		auto range = m_pending.equal_range(msg->GetDelegate()->Hash());
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second.get() == msg)
+			{
+				m_pending.erase(it);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// Get the number of pending messages.
+	/// @return The pending message count.
+	std::size_t Size() const { return m_pending.size(); }
+
+private:
+	// Prevent copying objects
+	DelegateCoalesceTable(const DelegateCoalesceTable&) = delete;
+	DelegateCoalesceTable& operator=(const DelegateCoalesceTable&) = delete;
+
+	std::mutex m_lock;
+	std::unordered_multimap<std::size_t, std::shared_ptr<DelegateMsg>> m_pending;
+};
+
+}
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef _DELEGATE_FUTURE_H
+#define _DELEGATE_FUTURE_H
+
+/// @file
+/// @brief Delegate library future and promise used by `AsyncInvokeFuture()`.
+///
+/// @details A `DelegatePromise` is sent with the asynchronous call message to the destination
+/// thread. The destination thread fulfills the promise directly within `Invoke()` once the
+/// target function returns, so the source thread is not blocked and no extra thread is
+/// required to wait for the result. The source thread either polls or waits on the
+/// `DelegateFuture`, or chains a continuation using `Then()`.
+///
+/// A continuation executes on the thread that fulfills the promise, typically the
+/// destination thread, or immediately on the calling thread if the result is already
+/// available. If the promise is destroyed before fulfilled, for instance the destination
+/// thread exits with the message still queued, the future completes without a value
+/// and each chained continuation completes without a value.
+///
+/// The promise and future share a single heap allocated state. A future is a single
+/// consumer: `Get()` and `Then()` move the result out and invalidate the future.
+
+#include "DelegateOpt.h"
+#include <condition_variable>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+// Fix compiler error on Windows
+#undef max
+
+namespace DelegateLib {
+
+/// @brief The stored future result type. A `void` result is stored as `bool`.
+template <class T>
+using DelegateFutureValue = std::conditional_t<std::is_void<T>::value, bool, std::decay_t<T>>;
+
+/// @brief The state shared between a `DelegatePromise` and `DelegateFuture`.
+/// @tparam T The result type.
+template <class T>
+class DelegateFutureState
+{
+public:
+    using ValueType = DelegateFutureValue<T>;
+
+    /// Complete the state with a result, or without a result if `value` is empty.
+    /// Wakes all waiters and runs the continuation, if any. Only the first call has any effect.
+    /// @param[in] value - the result.
+    void Complete(std::optional<ValueType>&& value) {
+        std::function<void(std::optional<ValueType>&&)> then;
+        {
+            std::lock_guard<std::mutex> lk(m_lock);
+            if (m_ready)
+                return;
+            m_value = std::move(value);
+            m_ready = true;
+            then = std::move(m_then);
+        }
+        m_cond.notify_all();
+
+        // The future was consumed by Then() so the value is owned by the continuation
+        if (then)
+            then(std::move(m_value));
+    }
+
+    /// Set the continuation invoked when the state completes. Invoked immediately on
+    /// the calling thread if the state is already complete.
+    /// @param[in] then - the continuation.
+    void SetThen(std::function<void(std::optional<ValueType>&&)>&& then) {
+        {
+            std::lock_guard<std::mutex> lk(m_lock);
+            if (!m_ready) {
+                m_then = std::move(then);
+                return;
+            }
+        }
+        then(std::move(m_value));
+    }
+
+    /// Wait for the state to complete.
+    /// @param[in] timeout - timeout in milliseconds
+    /// @return `true` if completed, `false` if the timeout expired.
+    bool Wait(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lk(m_lock);
+        if (timeout == std::chrono::milliseconds::max()) {
+            m_cond.wait(lk, [this] { return m_ready; });
+            return true;
+        }
+        return m_cond.wait_for(lk, timeout, [this] { return m_ready; });
+    }
+
+    /// Check if the state is complete.
+    /// @return `true` if completed.
+    bool IsReady() {
+        std::lock_guard<std::mutex> lk(m_lock);
+        return m_ready;
+    }
+
+    /// Move the result out of a completed state.
+    /// @return The result, or an empty value if completed without a result.
+    std::optional<ValueType> Take() {
+        std::lock_guard<std::mutex> lk(m_lock);
+        return std::move(m_value);
+    }
+
+private:
+    std::mutex m_lock;
+    std::condition_variable m_cond;
+    bool m_ready = false;
+    std::optional<ValueType> m_value;
+    std::function<void(std::optional<ValueType>&&)> m_then;
+};
+
+template <class T>
+class DelegatePromise;
+
+/// @brief The source thread side of an asynchronous call result.
+/// @tparam T The target function return type.
+template <class T>
+class DelegateFuture
+{
+public:
+    using ValueType = DelegateFutureValue<T>;
+
+    DelegateFuture() = default;
+    DelegateFuture(DelegateFuture&&) noexcept = default;
+    DelegateFuture& operator=(DelegateFuture&&) noexcept = default;
+
+    /// Check if the future refers to a result. `false` if default constructed or
+    /// the result was consumed by `Get()` or `Then()`.
+    /// @return `true` if valid.
+    bool IsValid() const noexcept { return m_state != nullptr; }
+
+    /// Check if the result is available without blocking.
+    /// @return `true` if the destination thread completed the call.
+    bool IsReady() const { return m_state && m_state->IsReady(); }
+
+    /// Wait for the destination thread to complete the call.
+    /// @param[in] timeout - timeout in milliseconds
+    /// @return `true` if completed, `false` if the timeout expired or the future is invalid.
+    bool Wait(std::chrono::milliseconds timeout = std::chrono::milliseconds::max()) const {
+        return m_state && m_state->Wait(timeout);
+    }
+
+    /// Wait for and move out the target function return value. Invalidates the future.
+    /// @param[in] timeout - timeout in milliseconds
+    /// @return The return value stored within `std::optional`. Empty if the timeout expired,
+    /// the future is invalid, or the call was never invoked. A `void` target function
+    /// returns `true` if invoked.
+    std::optional<ValueType> Get(std::chrono::milliseconds timeout = std::chrono::milliseconds::max()) {
+        if (!Wait(timeout))
+            return std::optional<ValueType>();
+        auto state = std::move(m_state);
+        return state->Take();
+    }
+
+    /// Chain a continuation invoked with the target function return value. Invalidates
+    /// the future.
+    /// @details The continuation runs on the thread that completes the call, typically the
+    /// destination thread, or immediately if the call already completed. The continuation
+    /// is not called if the target function is never invoked.
+    /// @param[in] func - the continuation. Called with the return value, or with no
+    /// arguments for a `void` target function.
+    /// @return A future for the continuation return value.
+    template <class F>
+    auto Then(F&& func) {
+        using U = typename ThenResult<F>::type;
+        auto next = std::make_shared<DelegateFutureState<U>>();
+        if (!m_state) {
+            next->Complete(std::optional<DelegateFutureValue<U>>());
+            return DelegateFuture<U>(next);
+        }
+        auto state = std::move(m_state);
+        state->SetThen([next, f = std::forward<F>(func)](std::optional<ValueType>&& value) mutable {
+            if (!value.has_value()) {
+                next->Complete(std::optional<DelegateFutureValue<U>>());
+            } else if constexpr (std::is_void<U>::value) {
+                if constexpr (std::is_void<T>::value)
+                    f();
+                else
+                    f(std::move(*value));
+                next->Complete(std::optional<bool>(true));
+            } else {
+                if constexpr (std::is_void<T>::value)
+                    next->Complete(std::optional<DelegateFutureValue<U>>(f()));
+                else
+                    next->Complete(std::optional<DelegateFutureValue<U>>(f(std::move(*value))));
+            }
+        });
+        return DelegateFuture<U>(next);
+    }
+
+private:
+    template <class U> friend class DelegateFuture;
+    template <class U> friend class DelegatePromise;
+
+    explicit DelegateFuture(std::shared_ptr<DelegateFutureState<T>> state) : m_state(std::move(state)) {}
+
+    // Prevent copying objects. A future is a single consumer.
+    DelegateFuture(const DelegateFuture&) = delete;
+    DelegateFuture& operator=(const DelegateFuture&) = delete;
+
+    template <class F, bool = std::is_void<T>::value>
+    struct ThenResult { using type = std::invoke_result_t<F, ValueType&&>; };
+
+    template <class F>
+    struct ThenResult<F, true> { using type = std::invoke_result_t<F>; };
+
+    std::shared_ptr<DelegateFutureState<T>> m_state;
+};
+
+/// @brief The destination thread side of an asynchronous call result.
+/// @details Destroying an unfulfilled promise completes the future without a value.
+/// @tparam T The target function return type.
+template <class T>
+class DelegatePromise
+{
+public:
+    using ValueType = DelegateFutureValue<T>;
+
+    /// Constructor. Creates the shared state.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and USE_ASSERTS not defined.
+    DelegatePromise() : m_state(std::make_shared<DelegateFutureState<T>>()) {}
+
+    DelegatePromise(DelegatePromise&&) noexcept = default;
+
+    ~DelegatePromise() {
+        if (m_state)
+            m_state->Complete(std::optional<ValueType>());
+    }
+
+    /// Get the future bound to this promise. Call once.
+    /// @return The future.
+    DelegateFuture<T> GetFuture() { return DelegateFuture<T>(m_state); }
+
+    /// Fulfill the promise with the return value of `func`.
+    /// @param[in] func - the callable to invoke. Returns `T`.
+    template <class F>
+    void SetValueFrom(F&& func) {
+        if (!m_state)
+            return;
+        auto state = std::move(m_state);
+        if constexpr (std::is_void<T>::value) {
+            func();
+            state->Complete(std::optional<bool>(true));
+        } else {
+            state->Complete(std::optional<ValueType>(func()));
+        }
+    }
+
+private:
+    // Prevent copying objects
+    DelegatePromise(const DelegatePromise&) = delete;
+    DelegatePromise& operator=(const DelegatePromise&) = delete;
+
+    std::shared_ptr<DelegateFutureState<T>> m_state;
+};
+
+}
+
+#endif
@@ -54,9 +54,13 @@
 /// See README.md, DETAILS.md, and source code Doxygen comments for more information.
 
 #include "DelegateOpt.h"
+#include "DelegateValue.h"
+#include "MulticastDelegate.h"
+#include "MulticastDelegateInline.h"
 #include "MulticastDelegateSafe.h"
 #include "UnicastDelegate.h"
 #include "DelegateAsync.h"
 #include "DelegateAsyncWait.h"
+#include "DelegateAwait.h"
 
 #endif
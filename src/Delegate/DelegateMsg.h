@@ -7,16 +7,64 @@
 #include "Fault.h"
 #include "DelegateInvoker.h"
 #include "DelegateOpt.h"
+#include "DelegateTypeId.h"
 #include "Semaphore.h"
+#include "Completion.h"
 #include "make_tuple_heap.h"
 #include <tuple>
 #include <list>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <stdexcept>
 
 namespace DelegateLib {
 
+class DelegateMsg;
+class DelegateBase;
+
+/// @brief Dispatch priority of an asynchronous delegate message. A `DelegateThread` 
+/// that supports priorities invokes queued higher priority messages first. Messages 
+/// of equal priority are invoked in dispatch order.
+enum class DelegatePriority
+{
+	LOW,
+	NORMAL,
+	HIGH
+};
+
+/// The number of `DelegatePriority` levels
+constexpr std::size_t DELEGATE_PRIORITY_LEVELS = 3;
+
+/// @brief Intrusive queue link embedded within each message. Allows a `DelegateThread` 
+/// implementation to queue a message without allocating a separate queue node.
+struct DelegateMsgLink
+{
+	/// The next link in the queue
+	std::atomic<DelegateMsgLink*> next{ nullptr };
+
+	/// Keeps the message alive while the message is queued
+	std::shared_ptr<DelegateMsg> msg;
+};
+
+/// @brief Trace state carried by a message sampled by `DelegateTracer`. 
+struct DelegateMsgTrace
+{
+	/// The trace identifier, or 0 if the message is not sampled
+	std::uint64_t id = 0;
+
+	/// The tracer thread identifier of the source thread
+	std::uint64_t sourceTid = 0;
+
+	/// The time the source thread called the delegate in nanoseconds
+	std::int64_t sendNs = 0;
+
+	/// The time the message was dispatched to the destination thread in nanoseconds
+	std::int64_t enqueueNs = 0;
+};
+
 /// @brief Base class for all delegate inter-thread messages
 class DelegateMsg
 {
@@ -34,12 +82,113 @@ public:
 	/// @return The invoker instance. 
 	std::shared_ptr<IDelegateInvoker> GetDelegateInvoker() const { return m_invoker; }
 
+	/// Get the intrusive queue link for this message. 
+	/// @return The queue link.
+	DelegateMsgLink& GetLink() { return m_link; }
+
+	/// Get the most derived message type identifier. 
+	/// @return The type identifier set by the derived class, or `nullptr` if not set.
+	DelegateTypeId GetTypeId() const { return m_typeId; }
+
+	/// Get the message dispatch priority.
+	/// @return The priority. Defaults to `DelegatePriority::NORMAL`.
+	DelegatePriority GetPriority() const { return m_priority; }
+
+	/// Set the message dispatch priority. Called by the source thread before the 
+	/// message is dispatched.
+	/// @param[in] priority - the dispatch priority.
+	void SetPriority(DelegatePriority priority) { m_priority = priority; }
+
+	/// Called by a `DelegateThread` before dropping the queued message without invoking 
+	/// the target function, for instance when a bounded queue overflows.
+	/// @return `true` if the message may be dropped. `false` if the message must be 
+	/// invoked, in which case the thread queues the message regardless.
+	virtual bool TryDiscard() { return false; }
+
+	/// Get the delegate embedded within the message. Used to find queued messages 
+	/// bound to the same target function.
+	/// @return The delegate, or `nullptr` if not available.
+	virtual const DelegateBase* GetDelegate() const { return nullptr; }
+
+	/// Get the time the message was dispatched. Set by a `DelegateThread` recording 
+	/// instrumentation, see `DelegateThreadStats`.
+	/// @return The dispatch time, or a default constructed time point if not set.
+	std::chrono::steady_clock::time_point GetDispatchTime() const { return m_dispatchTime; }
+
+	/// Set the time the message was dispatched. 
+	/// @param[in] time - the dispatch time.
+	void SetDispatchTime(std::chrono::steady_clock::time_point time) { m_dispatchTime = time; }
+
+	/// Get the time the source thread stops waiting for the message to be invoked. 
+	/// A `DelegateThread` blocking the source thread during dispatch, for instance on a 
+	/// full bounded queue, does not block past the deadline.
+	/// @return The deadline, or `time_point::max()` if the source thread waits indefinitely.
+	std::chrono::steady_clock::time_point GetDeadline() const { return m_deadline; }
+
+	/// Set the time the source thread stops waiting for the message to be invoked. 
+	/// Called by the source thread before the message is dispatched.
+	/// @param[in] deadline - the deadline.
+	void SetDeadline(std::chrono::steady_clock::time_point deadline) { m_deadline = deadline; }
+
+	/// Get the trace state of the message. See `DelegateTracer`.
+	/// @return The trace state.
+	DelegateMsgTrace& GetTrace() { return m_trace; }
+	const DelegateMsgTrace& GetTrace() const { return m_trace; }
+
+protected:
+	/// Constructor for a derived message that embeds the invoker instance. The 
+	/// derived class calls `SetDelegateInvoker()` once the invoker is constructed.
+	DelegateMsg() = default;
+
+	/// Set the invoker instance embedded within the derived message. The invoker 
+	/// lifetime is bound to the message lifetime so no reference count is held.
+	/// @param[in] invoker - the embedded invoker instance.
+	void SetDelegateInvoker(IDelegateInvoker* invoker)
+	{
+		m_invoker = std::shared_ptr<IDelegateInvoker>(std::shared_ptr<IDelegateInvoker>(), invoker);
+	}
+
+	/// Set the most derived message type identifier. Called by the derived class 
+	/// constructor so `DelegateMsgCast()` can downcast without RTTI.
+	/// @param[in] typeId - the derived class type identifier.
+	void SetTypeId(DelegateTypeId typeId) { m_typeId = typeId; }
+
 private:
 	/// The IDelegateInvoker instance used to invoke the target function 
     /// on the destination thread of control
 	std::shared_ptr<IDelegateInvoker> m_invoker;
+
+	/// The intrusive queue link
+	DelegateMsgLink m_link;
+
+	/// The most derived message type identifier
+	DelegateTypeId m_typeId = nullptr;
+
+	/// The message dispatch priority
+	DelegatePriority m_priority = DelegatePriority::NORMAL;
+
+	/// The time the message was dispatched
+	std::chrono::steady_clock::time_point m_dispatchTime;
+
+	/// The time the source thread stops waiting for the message to be invoked
+	std::chrono::steady_clock::time_point m_deadline = std::chrono::steady_clock::time_point::max();
+
+	/// The trace state
+	DelegateMsgTrace m_trace;
 };
 
+/// Downcast a message to the derived message type using a type identifier compare.
+/// @tparam T The derived message type.
+/// @param[in] msg - the message to downcast.
+/// @return The derived message pointer, or `nullptr` if `msg` is not a `T`.
+template <class T>
+std::shared_ptr<T> DelegateMsgCast(const std::shared_ptr<DelegateMsg>& msg)
+{
+	if (msg && msg->GetTypeId() == GetDelegateTypeId<T>())
+		return std::static_pointer_cast<T>(msg);
+	return nullptr;
+}
+
 }
 
 #endif
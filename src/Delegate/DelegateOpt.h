@@ -24,14 +24,41 @@
 #ifdef USE_ALLOCATOR
     // Use stl_allocator fixed block allocator for dynamic storage allocation
     #include "xlist.h"
+    #include "xunordered_map.h"
     #include "stl_allocator.h"
+    #include <memory>
+
+    // Create a shared object with the object and control block in a single 
+    // fixed block allocation
+    template <typename T, typename... Args>
+    std::shared_ptr<T> xmake_shared(Args&&... args) {
+        return std::allocate_shared<T>(stl_allocator<T>(), std::forward<Args>(args)...);
+    }
 #else
     #include <list>
+    #include <unordered_map>
+    #include <functional>
+    #include <memory>
 
     // Use default std::allocator for dynamic storage allocation
     template <typename T, typename Alloc = std::allocator<T>>
     using xlist = std::list<T, Alloc>;
 
+    template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+        typename Alloc = std::allocator<std::pair<const Key, Value>>>
+    using xunordered_map = std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>;
+
+    template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+        typename Alloc = std::allocator<std::pair<const Key, Value>>>
+    using xunordered_multimap = std::unordered_multimap<Key, Value, Hash, KeyEqual, Alloc>;
+
+    // Create a shared object with the object and control block in a single 
+    // allocation
+    template <typename T, typename... Args>
+    std::shared_ptr<T> xmake_shared(Args&&... args) {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
     #define XALLOCATOR
 #endif
 
@@ -0,0 +1,449 @@
+#ifndef _DELEGATE_STATS_H
+#define _DELEGATE_STATS_H
+
+/// @file
+/// @brief Delegate thread instrumentation.
+///
+/// @details Each `DelegateThread` owns a `DelegateThreadStats` instance. Once enabled
+/// using `SetEnabled()`, the thread records:
+///
+/// * Enqueue, dequeue and discard counts, the current and maximum queue depth.
+/// * A histogram of the time each message waits in the queue before invoke.
+/// * A histogram of the handler execution time, overall and per target function.
+///
+/// Counters and histogram buckets are relaxed atomics. Targets are keyed by the delegate 
+/// `Hash()` and found using a lock-free lookup table, so recording only takes a lock the 
+/// first time a target is seen, or for targets beyond `MAX_FAST_TARGETS`.
+/// Name a target using `SetTargetName()` to identify it within a snapshot.
+/// `GetSnapshot()` copies the counters at any time from any thread and `ToJson()`
+/// exports the snapshot.
+/// The handler time of a blocking call is recorded after the caller is released, so a
+/// snapshot taken as soon as the call returns may not include it.
+///
+/// When disabled, the default, each message costs a single relaxed atomic load.
+
+#include "Delegate.h"
+#include "DelegateMsg.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace DelegateLib {
+
+/// @brief A copy of a `DelegateHistogram` taken at one point in time.
+struct DelegateHistogramSnapshot
+{
+	/// The number of power of two buckets
+	static constexpr std::size_t BUCKETS = 32;
+
+	/// The number of samples
+	std::uint64_t count = 0;
+
+	/// The sum of all samples in nanoseconds
+	std::uint64_t sumNs = 0;
+
+	/// The largest sample in nanoseconds
+	std::uint64_t maxNs = 0;
+
+	/// Bucket 0 counts 0 ns samples. Bucket `i` counts samples within [2^(i-1), 2^i) ns.
+	/// The last bucket also counts all larger samples.
+	std::array<std::uint64_t, BUCKETS> buckets{};
+
+	/// Get the mean sample.
+	/// @return The mean in nanoseconds, or 0 if no samples.
+	double MeanNs() const { return count ? static_cast<double>(sumNs) / count : 0.0; }
+
+	/// Get an upper bound of a percentile sample.
+	/// @param[in] percentile - the percentile from 0.0 to 1.0.
+	/// @return The upper bound of the bucket holding the percentile sample in
+	/// nanoseconds, limited to `maxNs`. 0 if no samples.
+	std::uint64_t PercentileNs(double percentile) const
+	{
+		if (count == 0)
+			return 0;
+		std::uint64_t rank = static_cast<std::uint64_t>(percentile * (count - 1)) + 1;
+		std::uint64_t total = 0;
+		for (std::size_t i = 0; i < BUCKETS; i++)
+		{
+			total += buckets[i];
+			if (total >= rank)
+				return std::min<std::uint64_t>(i == 0 ? 0 : (std::uint64_t(1) << i) - 1, maxNs);
+		}
+		return maxNs;
+	}
+};
+
+/// @brief Lock-free histogram of nanosecond durations using power of two buckets.
+class DelegateHistogram
+{
+public:
+	static constexpr std::size_t BUCKETS = DelegateHistogramSnapshot::BUCKETS;
+
+	DelegateHistogram() { Reset(); }
+
+	/// Record a sample. Called by any thread.
+	/// @param[in] ns - the sample duration in nanoseconds.
+	void Record(std::uint64_t ns)
+	{
+		m_buckets[BucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+		m_count.fetch_add(1, std::memory_order_relaxed);
+		m_sumNs.fetch_add(ns, std::memory_order_relaxed);
+		std::uint64_t max = m_maxNs.load(std::memory_order_relaxed);
+		while (ns > max && !m_maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+	}
+
+	/// Copy the histogram. Samples recorded concurrently may be partially included.
+	/// @return The histogram snapshot.
+	DelegateHistogramSnapshot GetSnapshot() const
+	{
+		DelegateHistogramSnapshot snapshot;
+		snapshot.count = m_count.load(std::memory_order_relaxed);
+		snapshot.sumNs = m_sumNs.load(std::memory_order_relaxed);
+		snapshot.maxNs = m_maxNs.load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < BUCKETS; i++)
+			snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+		return snapshot;
+	}
+
+	/// Clear all samples.
+	void Reset()
+	{
+		for (auto& bucket : m_buckets)
+			bucket.store(0, std::memory_order_relaxed);
+		m_count.store(0, std::memory_order_relaxed);
+		m_sumNs.store(0, std::memory_order_relaxed);
+		m_maxNs.store(0, std::memory_order_relaxed);
+	}
+
+private:
+	// Prevent copying objects
+	DelegateHistogram(const DelegateHistogram&) = delete;
+	DelegateHistogram& operator=(const DelegateHistogram&) = delete;
+
+	/// Get the bucket index of a sample, the number of significant bits
+	static std::size_t BucketIndex(std::uint64_t ns)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		std::size_t index = ns ? 64 - __builtin_clzll(ns) : 0;
+#else
+		std::size_t index = 0;
+		while (ns)
+		{
+			ns >>= 1;
+			index++;
+		}
+#endif
+		return index < BUCKETS ? index : BUCKETS - 1;
+	}
+
+	std::atomic<std::uint64_t> m_buckets[BUCKETS];
+	std::atomic<std::uint64_t> m_count;
+	std::atomic<std::uint64_t> m_sumNs;
+	std::atomic<std::uint64_t> m_maxNs;
+};
+
+/// @brief A copy of a `DelegateThreadStats` taken at one point in time.
+struct DelegateThreadStatsSnapshot
+{
+	/// Handler execution time of one target function
+	struct Target
+	{
+		/// The target delegate `Hash()`, or 0 for messages without a delegate
+		std::size_t hash = 0;
+
+		/// The name set using `SetTargetName()`, if any
+		std::string name;
+
+		/// The handler execution time
+		DelegateHistogramSnapshot handlerTime;
+	};
+
+	/// The number of messages dispatched to the thread
+	std::uint64_t enqueueCount = 0;
+
+	/// The number of messages removed from the queue and invoked
+	std::uint64_t dequeueCount = 0;
+
+	/// The number of messages dropped by the thread without invoking
+	std::uint64_t discardCount = 0;
+
+	/// The number of messages waiting to be invoked
+	std::uint64_t queueDepth = 0;
+
+	/// The largest number of messages waiting to be invoked
+	std::uint64_t maxQueueDepth = 0;
+
+	/// The time from dispatch to the start of the handler
+	DelegateHistogramSnapshot queueWait;
+
+	/// The handler execution time of all targets
+	DelegateHistogramSnapshot handlerTime;
+
+	/// The handler execution time of each target, largest total time first
+	std::vector<Target> targets;
+
+	/// Export the snapshot as a JSON object. Durations are in nanoseconds.
+	/// @return The JSON text.
+	std::string ToJson() const
+	{
+		std::ostringstream os;
+		os << "{\"enqueueCount\":" << enqueueCount
+			<< ",\"dequeueCount\":" << dequeueCount
+			<< ",\"discardCount\":" << discardCount
+			<< ",\"queueDepth\":" << queueDepth
+			<< ",\"maxQueueDepth\":" << maxQueueDepth
+			<< ",\"queueWait\":";
+		WriteHistogram(os, queueWait);
+		os << ",\"handlerTime\":";
+		WriteHistogram(os, handlerTime);
+		os << ",\"targets\":[";
+		for (std::size_t i = 0; i < targets.size(); i++)
+		{
+			os << (i ? "," : "") << "{\"hash\":" << targets[i].hash << ",\"name\":\"";
+			for (char c : targets[i].name)
+			{
+				if (c == '"' || c == '\\')
+					os << '\\';
+				os << (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+			}
+			os << "\",\"handlerTime\":";
+			WriteHistogram(os, targets[i].handlerTime);
+			os << "}";
+		}
+		os << "]}";
+		return os.str();
+	}
+
+private:
+	static void WriteHistogram(std::ostringstream& os, const DelegateHistogramSnapshot& h)
+	{
+		os << "{\"count\":" << h.count << ",\"sumNs\":" << h.sumNs << ",\"maxNs\":" << h.maxNs
+			<< ",\"p50Ns\":" << h.PercentileNs(0.50) << ",\"p99Ns\":" << h.PercentileNs(0.99)
+			<< ",\"buckets\":[";
+		for (std::size_t i = 0; i < h.buckets.size(); i++)
+			os << (i ? "," : "") << h.buckets[i];
+		os << "]}";
+	}
+};
+
+/// @brief Instrumentation of one `DelegateThread`. Recorded by the `DelegateThread`
+/// implementation and read by any thread.
+class DelegateThreadStats
+{
+public:
+	/// The number of targets found without locking. Further targets use a locked lookup.
+	static constexpr std::size_t MAX_FAST_TARGETS = 64;
+
+	DelegateThreadStats() = default;
+
+	/// Enable or disable recording. Messages dispatched before enabling are not
+	/// counted. Call `Reset()` after enabling on a busy thread for consistent counts.
+	/// @param[in] enabled - `true` to record. Defaults to `false`.
+	void SetEnabled(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+	/// Check if recording is enabled.
+	/// @return `true` if enabled.
+	bool IsEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+	/// Name the target function of a delegate within snapshots.
+	/// @param[in] delegate - any delegate bound to the target function and this thread.
+	/// @param[in] name - the target name.
+	void SetTargetName(const DelegateBase& delegate, const std::string& name)
+	{
+		std::lock_guard<std::mutex> lk(m_lock);
+		GetTarget(delegate.Hash()).name = name;
+	}
+
+	/// Copy all counters and histograms. Called by any thread.
+	/// @return The snapshot.
+	DelegateThreadStatsSnapshot GetSnapshot() const
+	{
+		DelegateThreadStatsSnapshot snapshot;
+		snapshot.enqueueCount = m_enqueueCnt.load(std::memory_order_relaxed);
+		snapshot.dequeueCount = m_dequeueCnt.load(std::memory_order_relaxed);
+		snapshot.discardCount = m_discardCnt.load(std::memory_order_relaxed);
+		std::uint64_t done = snapshot.dequeueCount + snapshot.discardCount;
+		snapshot.queueDepth = snapshot.enqueueCount > done ? snapshot.enqueueCount - done : 0;
+		snapshot.maxQueueDepth = m_maxDepth.load(std::memory_order_relaxed);
+		snapshot.queueWait = m_queueWait.GetSnapshot();
+		snapshot.handlerTime = m_handlerTime.GetSnapshot();
+
+		std::lock_guard<std::mutex> lk(m_lock);
+		for (auto& target : m_targets)
+		{
+			DelegateThreadStatsSnapshot::Target t;
+			t.hash = target.first;
+			t.name = target.second.name;
+			t.handlerTime = target.second.handlerTime->GetSnapshot();
+			snapshot.targets.push_back(std::move(t));
+		}
+		std::sort(snapshot.targets.begin(), snapshot.targets.end(), [](const auto& a, const auto& b) {
+			return a.handlerTime.sumNs > b.handlerTime.sumNs;
+		});
+		return snapshot;
+	}
+
+	/// Clear all counters and histograms. Target names are kept.
+	void Reset()
+	{
+		m_enqueueCnt.store(0, std::memory_order_relaxed);
+		m_dequeueCnt.store(0, std::memory_order_relaxed);
+		m_discardCnt.store(0, std::memory_order_relaxed);
+		m_maxDepth.store(0, std::memory_order_relaxed);
+		m_queueWait.Reset();
+		m_handlerTime.Reset();
+
+		std::lock_guard<std::mutex> lk(m_lock);
+		for (auto& target : m_targets)
+			target.second.handlerTime->Reset();
+	}
+
+	/// Record a message dispatched to the thread. Called by the source thread before
+	/// the message is queued.
+	/// @param[in] msg - the dispatched message.
+	void RecordEnqueue(DelegateMsg& msg)
+	{
+		msg.SetDispatchTime(std::chrono::steady_clock::now());
+		std::uint64_t enqueued = m_enqueueCnt.fetch_add(1, std::memory_order_relaxed) + 1;
+		std::uint64_t done = m_dequeueCnt.load(std::memory_order_relaxed) +
+			m_discardCnt.load(std::memory_order_relaxed);
+		std::uint64_t depth = enqueued > done ? enqueued - done : 0;
+		std::uint64_t max = m_maxDepth.load(std::memory_order_relaxed);
+		while (depth > max && !m_maxDepth.compare_exchange_weak(max, depth, std::memory_order_relaxed)) {}
+	}
+
+	/// Record a queued message dropped without invoking the target function.
+	void RecordDiscard() { m_discardCnt.fetch_add(1, std::memory_order_relaxed); }
+
+	/// Record a message removed from the queue. Called by the destination thread 
+	/// before invoking the target function.
+	/// @param[in] msg - the dequeued message.
+	/// @param[in] start - the time the handler starts.
+	void RecordDequeue(const DelegateMsg& msg, std::chrono::steady_clock::time_point start)
+	{
+		m_dequeueCnt.fetch_add(1, std::memory_order_relaxed);
+		auto dispatchTime = msg.GetDispatchTime();
+		if (start > dispatchTime)
+			m_queueWait.Record(ToNs(start - dispatchTime));
+	}
+
+	/// Record a target function invoked by the destination thread.
+	/// @param[in] msg - the invoked message.
+	/// @param[in] start - the time the handler started.
+	/// @param[in] end - the time the handler returned.
+	void RecordHandler(const DelegateMsg& msg, std::chrono::steady_clock::time_point start,
+		std::chrono::steady_clock::time_point end)
+	{
+		std::uint64_t handlerNs = ToNs(end - start);
+		m_handlerTime.Record(handlerNs);
+
+		const DelegateBase* delegate = msg.GetDelegate();
+		std::size_t hash = delegate ? delegate->Hash() : 0;
+		DelegateHistogram* histogram = FindHistogram(hash);
+		if (!histogram)
+		{
+			std::lock_guard<std::mutex> lk(m_lock);
+			histogram = GetTarget(hash).handlerTime.get();
+		}
+		histogram->Record(handlerNs);
+	}
+
+private:
+	// Prevent copying objects
+	DelegateThreadStats(const DelegateThreadStats&) = delete;
+	DelegateThreadStats& operator=(const DelegateThreadStats&) = delete;
+
+	struct Target
+	{
+		std::string name;
+		std::unique_ptr<DelegateHistogram> handlerTime;
+	};
+
+	/// The lock-free lookup table size. At most half full to keep probes short.
+	static constexpr std::size_t SLOTS = MAX_FAST_TARGETS * 2;
+
+	/// A lock-free lookup table entry. `hash` is written before `histogram` is 
+	/// published and neither changes afterwards.
+	struct Slot
+	{
+		std::size_t hash = 0;
+		std::atomic<DelegateHistogram*> histogram{ nullptr };
+	};
+
+	static std::uint64_t ToNs(std::chrono::steady_clock::duration duration)
+	{
+		return static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+	}
+
+	static std::size_t SlotIndex(std::size_t hash)
+	{
+		return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 32) & (SLOTS - 1);
+	}
+
+	/// Find a published target histogram without locking. Called by any thread.
+	/// @return The histogram, or `nullptr` if not published.
+	DelegateHistogram* FindHistogram(std::size_t hash) const
+	{
+		for (std::size_t i = SlotIndex(hash), n = 0; n < SLOTS; i = (i + 1) & (SLOTS - 1), n++)
+		{
+			DelegateHistogram* histogram = m_slots[i].histogram.load(std::memory_order_acquire);
+			if (!histogram)
+				return nullptr;
+			if (m_slots[i].hash == hash)
+				return histogram;
+		}
+		return nullptr;
+	}
+
+	/// Get or create a target. Called with `m_lock` held.
+	Target& GetTarget(std::size_t hash)
+	{
+		Target& target = m_targets[hash];
+		if (!target.handlerTime)
+		{
+			target.handlerTime = std::unique_ptr<DelegateHistogram>(new DelegateHistogram());
+
+			// Publish the new target to the lock-free lookup table
+			if (m_slotCnt < MAX_FAST_TARGETS)
+			{
+				std::size_t i = SlotIndex(hash);
+				while (m_slots[i].histogram.load(std::memory_order_relaxed))
+					i = (i + 1) & (SLOTS - 1);
+				m_slots[i].hash = hash;
+				m_slots[i].histogram.store(target.handlerTime.get(), std::memory_order_release);
+				m_slotCnt++;
+			}
+		}
+		return target;
+	}
+
+	std::atomic<bool> m_enabled{ false };
+	std::atomic<std::uint64_t> m_enqueueCnt{ 0 };
+	std::atomic<std::uint64_t> m_dequeueCnt{ 0 };
+	std::atomic<std::uint64_t> m_discardCnt{ 0 };
+	std::atomic<std::uint64_t> m_maxDepth{ 0 };
+	DelegateHistogram m_queueWait;
+	DelegateHistogram m_handlerTime;
+
+	/// Per-target handler time histograms. Never removed so a histogram pointer
+	/// remains valid outside the lock.
+	mutable std::mutex m_lock;
+	std::unordered_map<std::size_t, Target> m_targets;
+
+	/// Lock-free lookup of the first `MAX_FAST_TARGETS` targets. Written with `m_lock` held.
+	Slot m_slots[SLOTS];
+	std::size_t m_slotCnt = 0;
+};
+
+}
+
+#endif
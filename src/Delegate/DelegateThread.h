@@ -2,6 +2,10 @@
 #define _DELEGATE_THREAD_H
 
 #include "DelegateMsg.h"
+#include "DelegateCoalesce.h"
+#include "DelegateStats.h"
+#include "DelegateTrace.h"
+#include <string>
 
 namespace DelegateLib {
 
@@ -26,6 +30,107 @@ public:
 	/// @pre Caller *must* create the DelegateMsg argument dynamically.
 	/// @post The destination thread calls DelegateInvoke().
 	virtual void DispatchDelegate(std::shared_ptr<DelegateMsg> msg) = 0;
+
+	/// Get the delegate thread executing the calling code. 
+	/// @return The current delegate thread, or `nullptr` if the calling code is not 
+	/// executing on a delegate thread or the implementation does not call `SetCurrent()`.
+	static DelegateThread* GetCurrent() noexcept { return CurrentThread(); }
+
+	/// Get the thread name. Used to label the thread within a trace.
+	/// @return The thread name, or an empty string if the implementation has no name.
+	virtual std::string GetThreadName() { return std::string(); }
+
+	/// Called by an asynchronous delegate on the source thread before dispatching a
+	/// message. Samples the message for `DelegateTracer`.
+	/// @param[in] msg - the message to dispatch.
+	static void TraceSend(DelegateMsg& msg)
+	{
+		DelegateTracer::GetInstance().OnSend(msg, []() {
+			DelegateThread* current = GetCurrent();
+			return current ? current->GetThreadName() : std::string();
+		});
+	}
+
+	/// Get the pending coalescing messages dispatched to this thread. Used by 
+	/// coalescing asynchronous delegates.
+	/// @return The pending coalescing message table.
+	DelegateCoalesceTable& GetCoalesceTable() noexcept { return m_coalesceTable; }
+
+	/// Get the thread instrumentation. Disabled by default, see 
+	/// `DelegateThreadStats::SetEnabled()`.
+	/// @return The thread instrumentation.
+	DelegateThreadStats& GetStats() noexcept { return m_stats; }
+
+protected:
+	/// Called by the implementation on the source thread for each dispatched message
+	/// before the message is visible to the destination thread.
+	/// @param[in] msg - the dispatched message.
+	void RecordDispatch(DelegateMsg& msg)
+	{
+		if (m_stats.IsEnabled())
+			m_stats.RecordEnqueue(msg);
+		DelegateTracer::GetInstance().OnEnqueue(msg);
+	}
+
+	/// Called by the implementation for each queued message dropped without invoking
+	/// the target function.
+	/// @param[in] msg - the dropped message.
+	void RecordDiscard(const DelegateMsg& msg)
+	{
+		if (m_stats.IsEnabled() && msg.GetDispatchTime() != std::chrono::steady_clock::time_point())
+			m_stats.RecordDiscard();
+	}
+
+	/// Called by the implementation on the destination thread to invoke the target 
+	/// function bound to a message.
+	/// @param[in] msg - the message to invoke.
+	/// @return `true` if the target function was invoked.
+	bool InvokeDelegate(const std::shared_ptr<DelegateMsg>& msg)
+	{
+		auto invoker = msg->GetDelegateInvoker();
+		ASSERT_TRUE(invoker);
+
+		// Only time messages counted by RecordDispatch() or sampled by the tracer
+		bool timed = m_stats.IsEnabled() && msg->GetDispatchTime() != std::chrono::steady_clock::time_point();
+		bool traced = msg->GetTrace().id != 0;
+		if (!timed && !traced)
+			return invoker->Invoke(msg);
+
+		std::int64_t dequeueNs = traced ? DelegateTracer::Now() : 0;
+		auto start = std::chrono::steady_clock::now();
+		if (timed)
+			m_stats.RecordDequeue(*msg, start);
+		std::int64_t startNs = traced ? DelegateTracer::Now() : 0;
+		bool invoked = invoker->Invoke(msg);
+		auto end = std::chrono::steady_clock::now();
+		if (timed)
+			m_stats.RecordHandler(*msg, start, end);
+		if (traced)
+		{
+			DelegateTracer::GetInstance().OnInvoke(*msg, dequeueNs, startNs,
+				std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count(),
+				[this]() { return GetThreadName(); });
+		}
+		return invoked;
+	}
+
+	/// Called by the implementation on its own thread of control to register the 
+	/// thread returned by `GetCurrent()`. 
+	/// @param[in] thread - the delegate thread, or `nullptr` when the thread exits.
+	static void SetCurrent(DelegateThread* thread) noexcept { CurrentThread() = thread; }
+
+private:
+	static DelegateThread*& CurrentThread() noexcept
+	{
+		static thread_local DelegateThread* current = nullptr;
+		return current;
+	}
+
+	/// Pending coalescing messages
+	DelegateCoalesceTable m_coalesceTable;
+
+	/// Thread instrumentation
+	DelegateThreadStats m_stats;
 };
 
 }
@@ -0,0 +1,508 @@
+#ifndef _DELEGATE_TRACE_H
+#define _DELEGATE_TRACE_H
+
+/// @file
+/// @brief Sampling tracer of asynchronous delegate dispatch spans.
+///
+/// @details `DelegateTracer` records the path of sampled asynchronous delegate calls
+/// from the source thread to the destination thread. For each sampled message the
+/// tracer records the send, enqueue, dequeue, handler start and handler end times.
+///
+/// Tracing is disabled by default. `SetSampleRate(N)` traces one of every N messages
+/// sent by each source thread, so a large N keeps the cost low enough to remain
+/// enabled in production. When disabled, each message costs a single relaxed atomic
+/// load on the source thread.
+///
+/// The destination thread writes each completed record into its own lock-free ring
+/// buffer. When full, the oldest records are overwritten. `GetRecords()` and
+/// `ToChromeTrace()` read all buffers from any thread without blocking the writers.
+/// The buffer of an exited thread is freed by `Clear()`, so short lived threads do not
+/// accumulate buffers. Thread names are kept after the buffers are freed.
+/// Load the `ToChromeTrace()` output into `chrome://tracing` or https://ui.perfetto.dev.
+
+#include "Delegate.h"
+#include "DelegateMsg.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace DelegateLib {
+
+/// @brief One traced asynchronous delegate call. Times are `std::chrono::steady_clock`
+/// nanoseconds.
+struct DelegateTraceRecord
+{
+	/// The unique trace identifier
+	std::uint64_t id = 0;
+
+	/// The target delegate `Hash()`, or 0 if not available
+	std::uint64_t hash = 0;
+
+	/// The message dispatch priority
+	std::uint64_t priority = 0;
+
+	/// The tracer thread identifier of the source thread
+	std::uint64_t sourceTid = 0;
+
+	/// The tracer thread identifier of the destination thread
+	std::uint64_t tid = 0;
+
+	/// The time the source thread called the delegate
+	std::int64_t sendNs = 0;
+
+	/// The time the message was dispatched to the destination thread
+	std::int64_t enqueueNs = 0;
+
+	/// The time the destination thread took the message to invoke
+	std::int64_t dequeueNs = 0;
+
+	/// The time the target function started
+	std::int64_t startNs = 0;
+
+	/// The time the target function returned
+	std::int64_t endNs = 0;
+};
+
+/// @brief Single writer ring buffer of trace records owned by one thread. Readers
+/// use a per-slot sequence number to discard records overwritten while copying.
+class DelegateTraceBuffer
+{
+public:
+	/// Constructor
+	/// @param[in] tid - the tracer thread identifier.
+	/// @param[in] name - the thread name.
+	/// @param[in] capacity - the number of records. Rounded up to a power of two.
+	DelegateTraceBuffer(std::uint64_t tid, const std::string& name, std::size_t capacity) :
+		m_tid(tid), m_name(name)
+	{
+		std::size_t size = 1;
+		while (size < capacity)
+			size <<= 1;
+		m_slots = std::unique_ptr<Slot[]>(new Slot[size]);
+		m_mask = size - 1;
+	}
+
+	/// Get the tracer thread identifier.
+	std::uint64_t GetTid() const { return m_tid; }
+
+	/// Get the thread name.
+	const std::string& GetName() const { return m_name; }
+
+	/// Write a record. Called only by the owning thread.
+	/// @param[in] record - the record to write.
+	void Push(const DelegateTraceRecord& record)
+	{
+		std::uint64_t head = m_head.load(std::memory_order_relaxed);
+		Slot& slot = m_slots[head & m_mask];
+
+		// An odd sequence marks the slot as being written
+		slot.seq.store(head * 2 + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		std::uint64_t words[WORDS];
+		ToWords(record, words);
+		for (std::size_t i = 0; i < WORDS; i++)
+			slot.words[i].store(words[i], std::memory_order_relaxed);
+		slot.seq.store(head * 2 + 2, std::memory_order_release);
+		m_head.store(head + 1, std::memory_order_release);
+	}
+
+	/// Copy the records not yet overwritten or cleared. Called by any thread.
+	/// @param[out] records - the vector the records are appended to.
+	void Read(std::vector<DelegateTraceRecord>& records) const
+	{
+		std::uint64_t head = m_head.load(std::memory_order_acquire);
+		std::uint64_t first = m_first.load(std::memory_order_relaxed);
+		if (head - first > m_mask + 1)
+			first = head - (m_mask + 1);
+
+		for (std::uint64_t i = first; i < head; i++)
+		{
+			const Slot& slot = m_slots[i & m_mask];
+			std::uint64_t seq = slot.seq.load(std::memory_order_acquire);
+			std::uint64_t words[WORDS];
+			for (std::size_t w = 0; w < WORDS; w++)
+				words[w] = slot.words[w].load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			// Discard a record overwritten by the writer during the copy
+			if (seq != i * 2 + 2 || slot.seq.load(std::memory_order_relaxed) != seq)
+				continue;
+			records.push_back(FromWords(words));
+		}
+	}
+
+	/// Discard all records written so far. Called by any thread.
+	void Clear() { m_first.store(m_head.load(std::memory_order_acquire), std::memory_order_relaxed); }
+
+	/// Mark the buffer as no longer written. Called by the owning thread when it exits.
+	void Retire() { m_retired.store(true, std::memory_order_release); }
+
+	/// Check if the owning thread exited. 
+	/// @return `true` if no more records are written.
+	bool IsRetired() const { return m_retired.load(std::memory_order_acquire); }
+
+private:
+	// Prevent copying objects
+	DelegateTraceBuffer(const DelegateTraceBuffer&) = delete;
+	DelegateTraceBuffer& operator=(const DelegateTraceBuffer&) = delete;
+
+	static constexpr std::size_t WORDS = 10;
+
+	struct Slot
+	{
+		std::atomic<std::uint64_t> seq{ 0 };
+		std::atomic<std::uint64_t> words[WORDS] = {};
+	};
+
+	static void ToWords(const DelegateTraceRecord& r, std::uint64_t* w)
+	{
+		w[0] = r.id; w[1] = r.hash; w[2] = r.priority; w[3] = r.sourceTid; w[4] = r.tid;
+		w[5] = static_cast<std::uint64_t>(r.sendNs);
+		w[6] = static_cast<std::uint64_t>(r.enqueueNs);
+		w[7] = static_cast<std::uint64_t>(r.dequeueNs);
+		w[8] = static_cast<std::uint64_t>(r.startNs);
+		w[9] = static_cast<std::uint64_t>(r.endNs);
+	}
+
+	static DelegateTraceRecord FromWords(const std::uint64_t* w)
+	{
+		DelegateTraceRecord r;
+		r.id = w[0]; r.hash = w[1]; r.priority = w[2]; r.sourceTid = w[3]; r.tid = w[4];
+		r.sendNs = static_cast<std::int64_t>(w[5]);
+		r.enqueueNs = static_cast<std::int64_t>(w[6]);
+		r.dequeueNs = static_cast<std::int64_t>(w[7]);
+		r.startNs = static_cast<std::int64_t>(w[8]);
+		r.endNs = static_cast<std::int64_t>(w[9]);
+		return r;
+	}
+
+	const std::uint64_t m_tid;
+	const std::string m_name;
+	std::unique_ptr<Slot[]> m_slots;
+	std::uint64_t m_mask = 0;
+	std::atomic<std::uint64_t> m_head{ 0 };
+	std::atomic<std::uint64_t> m_first{ 0 };
+	std::atomic<bool> m_retired{ false };
+};
+
+/// @brief Process wide sampling tracer of asynchronous delegate calls. The
+/// `DelegateThread` base class and the asynchronous delegates call the `On...()`
+/// hooks.
+class DelegateTracer
+{
+public:
+	/// The default number of records kept by each thread
+	static const std::size_t DEFAULT_BUFFER_CAPACITY = 4096;
+
+	/// Get the tracer instance.
+	/// @return The tracer.
+	static DelegateTracer& GetInstance()
+	{
+		static DelegateTracer instance;
+		return instance;
+	}
+
+	/// Set the sample rate.
+	/// @param[in] rate - trace one of every `rate` messages sent by each source thread.
+	/// 1 traces all messages. 0 disables tracing, the default.
+	void SetSampleRate(std::uint32_t rate) noexcept { m_sampleRate.store(rate, std::memory_order_relaxed); }
+
+	/// Get the sample rate.
+	/// @return The sample rate, or 0 if disabled.
+	std::uint32_t GetSampleRate() const noexcept { return m_sampleRate.load(std::memory_order_relaxed); }
+
+	/// Set the number of records kept by each thread traced for the first time after the call.
+	/// @param[in] capacity - the number of records. Rounded up to a power of two.
+	void SetBufferCapacity(std::size_t capacity)
+	{
+		std::lock_guard<std::mutex> lk(m_lock);
+		m_bufferCapacity = capacity > 0 ? capacity : 1;
+	}
+
+	/// Name the target function of a delegate within the trace.
+	/// @param[in] delegate - any delegate bound to the target function and destination thread.
+	/// @param[in] name - the target name.
+	void SetTargetName(const DelegateBase& delegate, const std::string& name)
+	{
+		std::lock_guard<std::mutex> lk(m_lock);
+		m_targetNames[delegate.Hash()] = name;
+	}
+
+	/// Discard all records written so far. Thread names and target names are kept. 
+	/// Buffers of exited threads are freed.
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lk(m_lock);
+		for (auto it = m_buffers.begin(); it != m_buffers.end(); )
+		{
+			(*it)->Clear();
+			it = (*it)->IsRetired() ? m_buffers.erase(it) : it + 1;
+		}
+	}
+
+	/// Get the number of thread buffers held, including buffers of exited threads not 
+	/// yet freed by `Clear()`.
+	/// @return The number of buffers.
+	std::size_t GetBufferCount() const
+	{
+		std::lock_guard<std::mutex> lk(m_lock);
+		return m_buffers.size();
+	}
+
+	/// Copy the records of all threads, ordered by send time.
+	/// @return The trace records.
+	std::vector<DelegateTraceRecord> GetRecords() const
+	{
+		std::vector<DelegateTraceRecord> records;
+		{
+			std::lock_guard<std::mutex> lk(m_lock);
+			ReadRecords(records);
+		}
+		std::sort(records.begin(), records.end(), [](const auto& a, const auto& b) {
+			return a.sendNs < b.sendNs;
+		});
+		return records;
+	}
+
+	/// Export the records of all threads in Chrome trace event JSON format. Each record
+	/// is a handler span on the destination thread, a dispatch span on the source thread
+	/// and a flow arrow between them. Times are in microseconds from the first send.
+	/// @return The JSON text.
+	std::string ToChromeTrace() const
+	{
+		std::vector<DelegateTraceRecord> records;
+		std::unordered_map<std::uint64_t, std::string> threadNames;
+		std::unordered_map<std::size_t, std::string> targetNames;
+		{
+			std::lock_guard<std::mutex> lk(m_lock);
+			ReadRecords(records);
+			targetNames = m_targetNames;
+
+			// Name every buffered thread and every thread referenced by a record, 
+			// including source threads that exited after sending
+			auto addName = [this, &threadNames](std::uint64_t tid) {
+				auto name = m_threadNames.find(tid);
+				threadNames[tid] = name != m_threadNames.end() ? name->second : std::string();
+			};
+			for (auto& buffer : m_buffers)
+				addName(buffer->GetTid());
+			for (auto& r : records)
+			{
+				addName(r.sourceTid);
+				addName(r.tid);
+			}
+		}
+		std::sort(records.begin(), records.end(), [](const auto& a, const auto& b) {
+			return a.sendNs < b.sendNs;
+		});
+
+		std::int64_t origin = records.empty() ? 0 : records.front().sendNs;
+		auto us = [origin](std::int64_t ns) { return (ns - origin) / 1000.0; };
+
+		std::ostringstream os;
+		os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+		bool first = true;
+		for (auto& thread : threadNames)
+		{
+			os << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+				<< thread.first << ",\"args\":{\"name\":\"";
+			WriteString(os, thread.second.empty() ? "Thread " + std::to_string(thread.first) : thread.second);
+			os << "\"}}";
+			first = false;
+		}
+
+		for (auto& r : records)
+		{
+			std::ostringstream name;
+			auto target = targetNames.find(static_cast<std::size_t>(r.hash));
+			if (target != targetNames.end())
+				name << target->second;
+			else
+				name << "delegate 0x" << std::hex << r.hash;
+
+			// Handler span on the destination thread
+			os << (first ? "" : ",") << "\n{\"name\":\"";
+			WriteString(os, name.str());
+			os << "\",\"cat\":\"delegate\",\"ph\":\"X\",\"pid\":1,\"tid\":" << r.tid
+				<< ",\"ts\":" << us(r.startNs) << ",\"dur\":" << (r.endNs - r.startNs) / 1000.0
+				<< ",\"args\":{\"id\":" << r.id << ",\"priority\":" << r.priority
+				<< ",\"enqueueUs\":" << (r.enqueueNs - r.sendNs) / 1000.0
+				<< ",\"queueWaitUs\":" << (r.dequeueNs - r.enqueueNs) / 1000.0
+				<< ",\"dequeueToStartUs\":" << (r.startNs - r.dequeueNs) / 1000.0 << "}}";
+			first = false;
+
+			// Dispatch span on the source thread
+			os << ",\n{\"name\":\"dispatch ";
+			WriteString(os, name.str());
+			os << "\",\"cat\":\"delegate\",\"ph\":\"X\",\"pid\":1,\"tid\":" << r.sourceTid
+				<< ",\"ts\":" << us(r.sendNs) << ",\"dur\":" << (r.enqueueNs - r.sendNs) / 1000.0
+				<< ",\"args\":{\"id\":" << r.id << "}}";
+
+			// Flow arrow from the dispatch to the handler
+			os << ",\n{\"name\":\"dispatch\",\"cat\":\"delegate\",\"ph\":\"s\",\"id\":" << r.id
+				<< ",\"pid\":1,\"tid\":" << r.sourceTid << ",\"ts\":" << us(r.sendNs) << "}";
+			os << ",\n{\"name\":\"dispatch\",\"cat\":\"delegate\",\"ph\":\"f\",\"bp\":\"e\",\"id\":" << r.id
+				<< ",\"pid\":1,\"tid\":" << r.tid << ",\"ts\":" << us(r.startNs) << "}";
+		}
+		os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+		return os.str();
+	}
+
+	/// Called by the source thread for each asynchronous message before dispatch.
+	/// Samples the message and records the send time.
+	/// @param[in] msg - the message to dispatch.
+	/// @param[in] getThreadName - returns the source thread name. Called once per thread.
+	template <class NameFunc>
+	void OnSend(DelegateMsg& msg, NameFunc getThreadName)
+	{
+		std::uint32_t rate = m_sampleRate.load(std::memory_order_relaxed);
+		if (rate == 0 || !Sample(rate))
+			return;
+
+		auto& trace = msg.GetTrace();
+		trace.id = m_nextId.fetch_add(1, std::memory_order_relaxed);
+		trace.sourceTid = GetBuffer(getThreadName).GetTid();
+		trace.sendNs = Now();
+	}
+
+	/// Called by the source thread for each message dispatched to a `DelegateThread`.
+	/// @param[in] msg - the dispatched message.
+	void OnEnqueue(DelegateMsg& msg)
+	{
+		auto& trace = msg.GetTrace();
+		if (trace.id != 0)
+			trace.enqueueNs = Now();
+	}
+
+	/// Called by the destination thread after invoking a sampled message.
+	/// @param[in] msg - the invoked message.
+	/// @param[in] dequeueNs - the time the message was taken to invoke.
+	/// @param[in] startNs - the time the target function started.
+	/// @param[in] endNs - the time the target function returned.
+	/// @param[in] getThreadName - returns the destination thread name. Called once per thread.
+	template <class NameFunc>
+	void OnInvoke(const DelegateMsg& msg, std::int64_t dequeueNs, std::int64_t startNs,
+		std::int64_t endNs, NameFunc getThreadName)
+	{
+		auto& trace = msg.GetTrace();
+		DelegateTraceBuffer& buffer = GetBuffer(getThreadName);
+
+		DelegateTraceRecord record;
+		record.id = trace.id;
+		const DelegateBase* delegate = msg.GetDelegate();
+		record.hash = delegate ? delegate->Hash() : 0;
+		record.priority = static_cast<std::uint64_t>(msg.GetPriority());
+		record.sourceTid = trace.sourceTid;
+		record.tid = buffer.GetTid();
+		record.sendNs = trace.sendNs;
+		record.enqueueNs = trace.enqueueNs ? trace.enqueueNs : trace.sendNs;
+		record.dequeueNs = dequeueNs;
+		record.startNs = startNs;
+		record.endNs = endNs;
+		buffer.Push(record);
+	}
+
+	/// Get the current trace time.
+	/// @return The `std::chrono::steady_clock` time in nanoseconds.
+	static std::int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+private:
+	DelegateTracer() = default;
+
+	// Prevent copying objects
+	DelegateTracer(const DelegateTracer&) = delete;
+	DelegateTracer& operator=(const DelegateTracer&) = delete;
+
+	/// @brief Retires the calling thread buffer when the thread exits. Shares 
+	/// ownership of the buffer so retiring is safe after the tracer is destroyed.
+	struct BufferOwner
+	{
+		~BufferOwner()
+		{
+			if (buffer)
+				buffer->Retire();
+		}
+		std::shared_ptr<DelegateTraceBuffer> buffer;
+	};
+
+	/// Get the calling thread buffer, creating it on first use. Buffers are kept
+	/// after the thread exits until `Clear()` is called.
+	template <class NameFunc>
+	DelegateTraceBuffer& GetBuffer(NameFunc getThreadName)
+	{
+		std::shared_ptr<DelegateTraceBuffer>& buffer = CurrentBuffer().buffer;
+		if (!buffer)
+		{
+			std::string name = getThreadName();
+			std::lock_guard<std::mutex> lk(m_lock);
+			buffer = std::make_shared<DelegateTraceBuffer>(++m_nextTid, name, m_bufferCapacity);
+			m_buffers.push_back(buffer);
+			m_threadNames[buffer->GetTid()] = name;
+		}
+		return *buffer;
+	}
+
+	static BufferOwner& CurrentBuffer()
+	{
+		static thread_local BufferOwner owner;
+		return owner;
+	}
+
+	/// Copy the records of all threads. Called with `m_lock` held.
+	/// @param[out] records - the vector the records are appended to.
+	void ReadRecords(std::vector<DelegateTraceRecord>& records) const
+	{
+		for (auto& buffer : m_buffers)
+			buffer->Read(records);
+	}
+
+	/// Sample one of every `rate` calls made by the calling thread
+	static bool Sample(std::uint32_t rate)
+	{
+		static thread_local std::uint32_t countdown = 0;
+		if (countdown == 0 || countdown > rate)
+			countdown = rate;
+		return --countdown == 0;
+	}
+
+	static void WriteString(std::ostringstream& os, const std::string& str)
+	{
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\')
+				os << '\\';
+			os << (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+		}
+	}
+
+	std::atomic<std::uint32_t> m_sampleRate{ 0 };
+	std::atomic<std::uint64_t> m_nextId{ 1 };
+
+	mutable std::mutex m_lock;
+	std::size_t m_bufferCapacity = DEFAULT_BUFFER_CAPACITY;
+	std::uint64_t m_nextTid = 0;
+
+	/// Buffers of running threads, and of exited threads not yet cleared
+	std::vector<std::shared_ptr<DelegateTraceBuffer>> m_buffers;
+
+	/// Thread names by tracer thread identifier. Kept after an exited thread buffer is 
+	/// freed since records of other threads still reference its identifier.
+	std::unordered_map<std::uint64_t, std::string> m_threadNames;
+	std::unordered_map<std::size_t, std::string> m_targetNames;
+};
+
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef _DELEGATE_TYPE_ID_H
+#define _DELEGATE_TYPE_ID_H
+
+/// @file
+/// @brief Compile-time type identifier used to compare delegate and message types 
+/// without RTTI. 
+/// 
+/// @details Each type `T` is identified by the address of a static tag variable 
+/// instantiated for `T`, so comparing two type identifiers is a pointer compare. 
+/// The library does not require RTTI and may be built using `-fno-rtti`.
+
+namespace DelegateLib {
+
+/// Unique identifier of a type. 
+using DelegateTypeId = const void*;
+
+/// @brief Static tag variable instantiated once per type. 
+/// @details The tag is deliberately non-const. Identical constant data may be merged 
+/// by identical code folding (e.g. MSVC `/OPT:ICF`, `lld --icf=all`), which would give 
+/// two types the same identifier; mutable variables are never folded.
+template <class T>
+struct DelegateTypeTag {
+    inline static char id;
+};
+
+/// Get the unique type identifier of `T`.
+/// @tparam T The type to identify.
+/// @return The type identifier.
+template <class T>
+constexpr DelegateTypeId GetDelegateTypeId() noexcept {
+    return &DelegateTypeTag<T>::id;
+}
+
+}
+
+#endif
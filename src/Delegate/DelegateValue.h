@@ -0,0 +1,335 @@
+#ifndef _DELEGATE_VALUE_H
+#define _DELEGATE_VALUE_H
+
+/// @file
+/// @brief Value semantic delegate storing the target inline without dynamic storage
+/// allocation.
+///
+/// @details `DelegateValue<>` stores a free function, class member function, small
+/// callable object (e.g. a lambda) or small delegate within a fixed size buffer. The
+/// target is invoked through a function pointer thunk, so copying or invoking a
+/// `DelegateValue<>` never allocates memory. A target that does not fit the buffer is
+/// a compile time error.
+///
+/// `DelegateValue<>` inherits from `Delegate<>` and is therefore accepted by the delegate
+/// containers. Use `MulticastDelegateInline<>` to store instances without allocation.
+/// Assign the result of `MakeDelegate()` to create an instance from an existing delegate:
+///
+/// `DelegateValue<void(int)> d1 = MakeDelegate(&FreeFunc);`
+/// `DelegateValue<void(int)> d2(&myClass, &MyClass::MemberFunc);  // No allocation`
+/// `DelegateValue<void(int)> d3 = [&count](int i) { count += i; };`
+///
+/// Equality: function pointer and member function targets compare the bound function
+/// and object. Callable objects compare equal if the callable types are equal, similar to
+/// `DelegateFunction<>`. A `DelegateValue<>` holding a delegate compares equal to another
+/// `DelegateValue<>` holding an equal delegate. Like every delegate type, a `DelegateValue<>`
+/// only compares equal to the exact same delegate type, so `Equal()` is symmetric; wrap a
+/// delegate in a `DelegateValue<>` to compare it with a stored one.
+
+#include "Delegate.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace DelegateLib {
+
+/// Default `DelegateValue<>` buffer size in bytes. Large enough to store a `DelegateFree`,
+/// `DelegateMember`, `DelegateFunction` or `DelegateFreeAsync` instance.
+constexpr std::size_t DEFAULT_DELEGATE_VALUE_SIZE = 40;
+
+template <class R, std::size_t Size = DEFAULT_DELEGATE_VALUE_SIZE>
+class DelegateValue; // Not defined
+
+/// @brief `DelegateValue<>` class synchronously invokes a target stored inline.
+/// @tparam RetType The return type of the bound delegate function.
+/// @tparam Args The argument types of the bound delegate function.
+/// @tparam Size The inline target buffer size in bytes.
+template <class RetType, class... Args, std::size_t Size>
+class DelegateValue<RetType(Args...), Size> final : public Delegate<RetType(Args...)> {
+public:
+    using DelegateType = Delegate<RetType(Args...)>;
+    using ClassType = DelegateValue<RetType(Args...), Size>;
+    typedef RetType(*FreeFunc)(Args...);
+
+    /// @brief Default constructor creates an empty delegate.
+    DelegateValue() = default;
+
+    /// @brief Constructor to bind a free function.
+    /// @param[in] func The target free function to store.
+    DelegateValue(FreeFunc func) { if (func) Store(DelegateFree<RetType(Args...)>(func)); }
+
+    /// @brief Constructor to bind a class member function without allocation.
+    /// @param[in] object The target object pointer. Not owned.
+    /// @param[in] func The target member function to store.
+    template <class TClass>
+    DelegateValue(TClass* object, RetType(TClass::*func)(Args...)) {
+        if (object && func)
+            Store(MemberTarget<TClass, RetType(TClass::*)(Args...)>{ object, func });
+    }
+
+    /// @brief Constructor to bind a class const member function without allocation.
+    /// @param[in] object The target object pointer. Not owned.
+    /// @param[in] func The target const member function to store.
+    template <class TClass>
+    DelegateValue(TClass* object, RetType(TClass::*func)(Args...) const) {
+        if (object && func)
+            Store(MemberTarget<TClass, RetType(TClass::*)(Args...) const>{ object, func });
+    }
+
+    /// @brief Constructor to store a delegate, such as one returned by `MakeDelegate()`.
+    /// @param[in] delegate The delegate to store a copy of.
+    template <class TDelegate, typename = std::enable_if_t<
+        std::is_base_of_v<DelegateType, TDelegate> && !std::is_same_v<TDelegate, ClassType>>>
+    DelegateValue(const TDelegate& delegate) {
+        if (delegate != nullptr)
+            Store(delegate);
+    }
+
+    /// @brief Constructor to store a callable object such as a lambda.
+    /// @param[in] func The callable object to store a copy of.
+    template <class F, typename = std::enable_if_t<
+        !std::is_base_of_v<DelegateBase, std::decay_t<F>> &&
+        !std::is_pointer_v<std::decay_t<F>> &&
+        std::is_invocable_r_v<RetType, std::decay_t<F>&, Args...>>>
+    DelegateValue(F&& func) { Store(std::decay_t<F>(std::forward<F>(func))); }
+
+    /// @brief Copy constructor that creates a copy of the given instance.
+    /// @param[in] rhs The object to copy from.
+    DelegateValue(const ClassType& rhs) { Assign(rhs); }
+
+    /// @brief Move constructor. The target is copied since it is stored inline.
+    /// @param[in] rhs The object to move from.
+    DelegateValue(ClassType&& rhs) { Assign(rhs); rhs.Clear(); }
+
+    /// @brief Destructor ensures empty when destroyed.
+    ~DelegateValue() { Clear(); }
+
+    /// @brief Creates a copy of the current object.
+    /// @return A pointer to a new `ClassType` instance.
+    /// @post The caller is responsible for deleting the clone object.
+    virtual ClassType* Clone() const override {
+        return new(std::nothrow) ClassType(*this);
+    }
+
+    /// @brief Creates a copy of the current object within caller storage.
+    /// @param[in] buffer The storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the `ClassType` copy within `buffer`, or `nullptr`
+    /// if the copy does not fit.
+    /// @post The caller is responsible for calling the copy destructor.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) > size || alignof(ClassType) > alignof(std::max_align_t))
+            return nullptr;
+        return ::new(buffer) ClassType(*this);
+    }
+
+    /// @brief Get the most derived delegate type identifier.
+    /// @return The `ClassType` type identifier.
+    virtual DelegateTypeId GetTypeId() const noexcept override {
+        return GetDelegateTypeId<ClassType>();
+    }
+
+    /// @brief Assigns the state of one object to another.
+    /// @param[in] rhs The object whose state is to be copied.
+    void Assign(const ClassType& rhs) {
+        if (&rhs == this)
+            return;
+        Clear();
+        if (rhs.m_ops) {
+            rhs.m_ops->copy(m_buffer, rhs.m_buffer);
+            m_ops = rhs.m_ops;
+            m_invoke = rhs.m_invoke;
+        }
+    }
+
+    /// @brief Invoke the bound target function synchronously. Always safe to call.
+    /// @param[in] args - the function arguments, if any.
+    /// @return The bound function return value, if any. If empty delegate
+    /// default return type returned.
+    virtual RetType operator()(Args... args) override {
+        if (Empty())
+            return RetType();
+        return m_invoke(m_buffer, std::forward<Args>(args)...);
+    }
+
+    /// @brief Assignment operator that assigns the state of one object to another.
+    /// @param[in] rhs The object whose state is to be assigned to the current object.
+    /// @return A reference to the current object.
+    ClassType& operator=(const ClassType& rhs) {
+        Assign(rhs);
+        return *this;
+    }
+
+    /// @brief Move assignment operator.
+    /// @param[in] rhs The object to move from.
+    /// @return A reference to the current object.
+    ClassType& operator=(ClassType&& rhs) {
+        if (&rhs != this) {
+            Assign(rhs);
+            rhs.Clear();
+        }
+        return *this;
+    }
+
+    /// @brief Clear the target function.
+    virtual void operator=(std::nullptr_t) noexcept {
+        return Clear();
+    }
+
+    /// @brief Compares two delegate objects for equality.
+    /// @param[in] rhs The `DelegateBase` object to compare with the current object.
+    /// @return `true` if the two delegate objects are equal, `false` otherwise.
+    virtual bool Equal(const DelegateBase& rhs) const override {
+        auto derivedRhs = rhs.GetTypeId() == this->GetTypeId() ?
+            static_cast<const ClassType*>(&rhs) : nullptr;
+        if (derivedRhs) {
+            // If both delegates are empty, they are equal
+            if (Empty() || derivedRhs->Empty())
+                return Empty() && derivedRhs->Empty();
+            return m_ops == derivedRhs->m_ops && m_ops->equal(m_buffer, derivedRhs->m_buffer);
+        }
+        return false;
+    }
+
+    /// @brief Get a hash value consistent with `Equal()`.
+    /// @return The hash of the stored target.
+    virtual std::size_t Hash() const noexcept override {
+        if (Empty())
+            return DelegateType::Hash();
+        return DelegateHashCombine(std::hash<const void*>()(m_ops), m_ops->hash(m_buffer));
+    }
+
+    /// Compares two delegate objects for equality.
+    /// @return `true` if the objects are equal, `false` otherwise.
+    bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
+
+    /// Overload operator== to compare the delegate to nullptr
+    /// @return `true` if delegate is null.
+    virtual bool operator==(std::nullptr_t) const noexcept override {
+        return Empty();
+    }
+
+    /// Overload operator!= to compare the delegate to nullptr
+    /// @return `true` if delegate is not null.
+    virtual bool operator!=(std::nullptr_t) const noexcept override {
+        return !Empty();
+    }
+
+    /// Overload operator== to compare the delegate to nullptr
+    /// @return `true` if delegate is null.
+    friend bool operator==(std::nullptr_t, const ClassType& rhs) noexcept {
+        return rhs.Empty();
+    }
+
+    /// Overload operator!= to compare the delegate to nullptr
+    /// @return `true` if delegate is not null.
+    friend bool operator!=(std::nullptr_t, const ClassType& rhs) noexcept {
+        return !rhs.Empty();
+    }
+
+    /// @brief Check if the delegate is bound to a target function.
+    /// @return `true` if the delegate has a target function, `false` otherwise.
+    bool Empty() const noexcept { return m_ops == nullptr; }
+
+    /// @brief Clear the target function.
+    /// @post The delegate is empty.
+    void Clear() noexcept {
+        if (m_ops)
+            m_ops->destroy(m_buffer);
+        m_ops = nullptr;
+        m_invoke = nullptr;
+    }
+
+    /// @brief Implicit conversion operator to `bool`.
+    /// @return `true` if the object is not empty, `false` if the object is empty.
+    explicit operator bool() const noexcept { return !Empty(); }
+
+private:
+    /// Thunk to invoke the stored target
+    using InvokeFunc = RetType(*)(void* target, Args&&... args);
+
+    /// Operations on the stored target
+    struct Ops {
+        void (*copy)(void* dst, const void* src);
+        void (*destroy)(void* target);
+        bool (*equal)(const void* lhs, const void* rhs);
+        std::size_t (*hash)(const void* target);
+    };
+
+    /// @brief Member function target bound to a raw object pointer.
+    template <class TClass, class TFunc>
+    struct MemberTarget {
+        TClass* object;
+        TFunc func;
+
+        RetType operator()(Args... args) const {
+            return (object->*func)(std::forward<Args>(args)...);
+        }
+        bool operator==(const MemberTarget& rhs) const {
+            return object == rhs.object && func == rhs.func;
+        }
+    };
+
+    template <class T> struct IsMemberTarget : std::false_type {};
+    template <class TClass, class TFunc>
+    struct IsMemberTarget<MemberTarget<TClass, TFunc>> : std::true_type {};
+
+    /// @brief Thunks and operations for a stored target type.
+    template <class T>
+    struct Target {
+        static RetType Invoke(void* target, Args&&... args) {
+            if constexpr (std::is_base_of_v<DelegateType, T>)
+                return static_cast<T*>(target)->T::operator()(std::forward<Args>(args)...);
+            else
+                return (*static_cast<T*>(target))(std::forward<Args>(args)...);
+        }
+        static void Copy(void* dst, const void* src) {
+            ::new(dst) T(*static_cast<const T*>(src));
+        }
+        static void Destroy(void* target) {
+            static_cast<T*>(target)->~T();
+        }
+        static bool Equal(const void* lhs, const void* rhs) {
+            if constexpr (std::is_base_of_v<DelegateType, T> || IsMemberTarget<T>::value)
+                return *static_cast<const T*>(lhs) == *static_cast<const T*>(rhs);
+            else
+                return true;    // Same callable type
+        }
+        static std::size_t Hash(const void* target) {
+            if constexpr (std::is_base_of_v<DelegateType, T>) {
+                return static_cast<const T*>(target)->Hash();
+            }
+            else if constexpr (IsMemberTarget<T>::value) {
+                auto member = static_cast<const T*>(target);
+                return DelegateHashCombine(std::hash<const void*>()(member->object),
+                    DelegateHashBytes(&member->func, sizeof(member->func)));
+            }
+            else {
+                return std::hash<const void*>()(&ops);     // Same callable type
+            }
+        }
+
+        static inline const Ops ops = { &Copy, &Destroy, &Equal, &Hash };
+    };
+
+    /// Store a target within the buffer.
+    template <class T>
+    void Store(const T& target) {
+        static_assert(sizeof(T) <= Size, "Target too large for DelegateValue buffer");
+        static_assert(alignof(T) <= alignof(void*), "Target alignment not supported");
+        static_assert(std::is_copy_constructible_v<T>, "Target must be copy constructible");
+
+        ::new(m_buffer) T(target);
+        m_ops = &Target<T>::ops;
+        m_invoke = &Target<T>::Invoke;
+    }
+
+    InvokeFunc m_invoke = nullptr;
+    const Ops* m_ops = nullptr;
+    alignas(void*) unsigned char m_buffer[Size];
+};
+
+}
+
+#endif
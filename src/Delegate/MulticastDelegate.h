@@ -4,17 +4,65 @@
 /// @file
 /// @brief Delegate container for storing and iterating over a collection of 
 /// delegate instances. Class is not thread-safe.
+/// 
+/// @details Inserting a delegate returns a `DelegateHandle` subscription token. 
+/// Removing a delegate using the handle is O(1) average; the handle table is only 
+/// built by the first removal using a handle, so callers that never use handles pay 
+/// no extra allocation per insert. Removing a delegate by value is a 
+/// linear search unless the optional hash index is enabled using `EnableIndex()`, 
+/// which indexes the delegates by `Delegate::Hash()` (delegate type, bound object, 
+/// function and thread) for O(1) average removal. Invocation order is always the 
+/// insertion order.
 
 #include "Delegate.h"
 #include <list>
 #include <algorithm>
 #include <memory>
+#include <cstdint>
+#include <atomic>
 
 namespace DelegateLib {
 
 template <class R>
 struct MulticastDelegate; // Not defined
 
+/// @brief Subscription token returned when a delegate is inserted into a container. 
+/// Use the handle to remove the delegate without searching the container. 
+/// @details Subscription identifiers are unique across all containers, so a handle 
+/// returned by another container never removes a delegate. A container copy keeps the 
+/// identifiers, so a handle removes the copied subscription from the copy.
+class DelegateHandle {
+public:
+    DelegateHandle() = default;
+
+    /// Check if the handle refers to an inserted delegate.
+    /// @return `true` if the handle was returned by a container insert.
+    bool IsValid() const noexcept { return m_id != 0; }
+
+    /// @brief Implicit conversion operator to `bool`.
+    /// @return `true` if the handle is valid.
+    explicit operator bool() const noexcept { return IsValid(); }
+
+    bool operator==(const DelegateHandle& rhs) const noexcept { return m_id == rhs.m_id; }
+    bool operator!=(const DelegateHandle& rhs) const noexcept { return m_id != rhs.m_id; }
+
+private:
+    template <class R>
+    friend struct MulticastDelegate;
+
+    explicit DelegateHandle(std::uint64_t id) : m_id(id) {}
+
+    /// Issue a new process wide subscription identifier.
+    /// @return The subscription identifier. Never 0.
+    static std::uint64_t NextId() noexcept {
+        static std::atomic<std::uint64_t> nextId{ 0 };
+        return nextId.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    /// Unique subscription identifier. 0 is invalid.
+    std::uint64_t m_id = 0;
+};
+
 /// @brief Not thread-safe multicast delegate container class. The class has a list of 
 /// `Delegate<>` instances. When invoked, each `Delegate` instance within the invocation 
 /// list is called. 
@@ -30,20 +78,26 @@ public:
     /// @brief Copy constructor that creates a copy of the given instance.
     /// @details This constructor initializes a new object as a copy of the 
     /// provided `rhs` (right-hand side) object. The `rhs` object is used to 
-    /// set the state of the new instance.
+    /// set the state of the new instance. Handles returned by `rhs` remain 
+    /// valid for the copy.
     /// @param[in] rhs The object to copy from.
-    MulticastDelegate(const MulticastDelegate& rhs) { CopyFrom(rhs); }
+    MulticastDelegate(const MulticastDelegate& rhs) : m_indexed(rhs.m_indexed) { CopyFrom(rhs); }
 
     /// @brief Move constructor that transfers ownership of resources.
+    /// @details Handles returned by `rhs` remain valid for the new instance.
     /// @param[in] rhs The object to move from.
-    MulticastDelegate(MulticastDelegate&& rhs) noexcept : m_delegates(std::move(rhs.m_delegates)) { }
+    MulticastDelegate(MulticastDelegate&& rhs) noexcept : 
+        m_delegates(std::move(rhs.m_delegates)), m_handles(std::move(rhs.m_handles)),
+        m_index(std::move(rhs.m_index)), m_handled(rhs.m_handled), m_indexed(rhs.m_indexed) { 
+        rhs.Clear();
+    }
 
     /// Invoke all bound target functions. A void return value is used 
     /// since multiple targets invoked.
     /// @param[in] args The arguments used when invoking the target functions
     void operator()(Args... args) {
-        for (auto delegate : m_delegates)
-            (*delegate)(args...);	// Invoke delegate callback
+        for (const auto& entry : m_delegates)
+            (*entry.delegate)(args...);	// Invoke delegate callback
     }
 
     /// Invoke all bound target functions. A void return value is used 
@@ -55,11 +109,13 @@ public:
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
-    void operator+=(const DelegateType& delegate) { PushBack(delegate); }
+    /// @return The subscription handle used to remove the delegate.
+    DelegateHandle operator+=(const DelegateType& delegate) { return PushBack(delegate); }
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
-    void operator+=(DelegateType&& delegate) { PushBack(delegate); }
+    /// @return The subscription handle used to remove the delegate.
+    DelegateHandle operator+=(DelegateType&& delegate) { return PushBack(delegate); }
 
     /// Remove a delegate from the container.
     /// @param[in] delegate A delegate target to remove
@@ -69,12 +125,17 @@ public:
     /// @param[in] delegate A delegate target to remove
     void operator-=(DelegateType&& delegate) { Remove(delegate); }
 
+    /// Remove a delegate from the container.
+    /// @param[in] handle The subscription handle returned when inserted.
+    void operator-=(const DelegateHandle& handle) { Remove(handle); }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
     MulticastDelegate& operator=(const MulticastDelegate& rhs) {
         if (&rhs != this) {
             Clear();
+            m_indexed = rhs.m_indexed;
             CopyFrom(rhs);
         }
         return *this;
@@ -85,7 +146,11 @@ public:
     /// @return A reference to the current object.
     MulticastDelegate& operator=(MulticastDelegate&& rhs) noexcept {
         if (&rhs != this) {
-            m_delegates = rhs.m_delegates;
+            m_delegates = std::move(rhs.m_delegates);
+            m_handles = std::move(rhs.m_handles);
+            m_index = std::move(rhs.m_index);
+            m_handled = rhs.m_handled;
+            m_indexed = rhs.m_indexed;
             rhs.Clear();
         }
         return *this;
@@ -96,32 +161,81 @@ public:
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
-    void PushBack(const DelegateType& delegate) { 
+    /// @return The subscription handle used to remove the delegate.
+    DelegateHandle PushBack(const DelegateType& delegate) { 
         auto delegateClone = delegate.Clone();
         if (!delegateClone)
             BAD_ALLOC();
 
         try {
             std::shared_ptr<DelegateType> sharedDelegate(delegateClone);
-            m_delegates.push_back(std::forward<std::shared_ptr<DelegateType>>(sharedDelegate));
+            return Insert(std::move(sharedDelegate), DelegateHandle::NextId());
         }
         catch (const std::bad_alloc&) {
             BAD_ALLOC();
         }
+        return DelegateHandle();
     }
 
     /// Remove a delegate into the container.
+    /// @details The first inserted matching delegate is removed. 
     /// @param[in] delegate The delegate target to remove.
     void Remove(const DelegateType& delegate) {
+        if (m_indexed) {
+            // Find the earliest inserted matching delegate within the hash bucket
+            auto range = m_index.equal_range(delegate.Hash());
+            auto found = m_delegates.end();
+            for (auto it = range.first; it != range.second; ++it) {
+                if (*it->second->delegate == delegate &&
+                    (found == m_delegates.end() || it->second->id < found->id))
+                    found = it->second;
+            }
+            if (found != m_delegates.end())
+                Erase(found);
+            return;
+        }
+
         // Use std::find_if to locate the matching delegate
         auto it = std::find_if(m_delegates.begin(), m_delegates.end(),
-            [&delegate](const std::shared_ptr<DelegateType>& item) {
-                return *item == delegate;
+            [&delegate](const Entry& item) {
+                return *item.delegate == delegate;
             });
 
         // If found, erase the delegate
         if (it != m_delegates.end()) {
-            m_delegates.erase(it);
+            Erase(it);
+        }
+    }
+
+    /// Remove a delegate from the container using the subscription handle.
+    /// @details Does nothing if the delegate was already removed or the handle was 
+    /// returned by another container. The first call builds the handle table.
+    /// @param[in] handle The subscription handle returned when inserted.
+    void Remove(const DelegateHandle& handle) {
+        if (!handle.IsValid())
+            return;
+        if (!m_handled) {
+            for (auto it = m_delegates.begin(); it != m_delegates.end(); ++it)
+                m_handles.emplace(it->id, it);
+            m_handled = true;
+        }
+        auto it = m_handles.find(handle.m_id);
+        if (it != m_handles.end())
+            Erase(it->second);
+    }
+
+    /// Enable or disable the hash index used by `Remove(const DelegateType&)`. 
+    /// @details The index adds a hash table insert to each `PushBack()` and makes 
+    /// removal by value O(1) average instead of a linear search.
+    /// @param[in] enable `true` to build and maintain the index.
+    void EnableIndex(bool enable) {
+        m_indexed = enable;
+        m_index.clear();
+        if (enable) {
+            for (auto it = m_delegates.begin(); it != m_delegates.end(); ++it) {
+                it->hash = it->delegate->Hash();
+                m_index.emplace(it->hash, it);
+            }
         }
     }
 
@@ -130,7 +244,12 @@ public:
     bool Empty() const { return m_delegates.empty(); }
 
     /// Removal all registered delegates.
-    void Clear() { m_delegates.clear(); }
+    void Clear() { 
+        m_delegates.clear(); 
+        m_handles.clear();
+        m_index.clear();
+        m_handled = false;
+    }
 
     /// Get the number of delegates stored.
     /// @return The number of delegates stored.
@@ -141,17 +260,65 @@ public:
     explicit operator bool() const { return !Empty(); }
 
 private:
-    /// Copy all delegate container objects.
+    /// @brief A registered delegate and its subscription identifier.
+    struct Entry {
+        std::shared_ptr<DelegateType> delegate;
+        std::uint64_t id;
+        std::size_t hash;
+    };
+    using ListType = xlist<Entry>;
+    using Iterator = typename ListType::iterator;
+
+    /// Append a delegate to the invocation list and index it.
+    /// @param[in] delegate The delegate to append.
+    /// @param[in] id The subscription identifier.
+    /// @return The subscription handle.
+    DelegateHandle Insert(std::shared_ptr<DelegateType> delegate, std::uint64_t id) {
+        const std::size_t hash = m_indexed ? delegate->Hash() : 0;
+        m_delegates.push_back(Entry{ std::move(delegate), id, hash });
+        auto it = std::prev(m_delegates.end());
+        try {
+            if (m_handled)
+                m_handles.emplace(id, it);
+            if (m_indexed)
+                m_index.emplace(hash, it);
+        }
+        catch (const std::bad_alloc&) {
+            m_handles.erase(id);
+            m_delegates.erase(it);
+            throw;
+        }
+        return DelegateHandle(id);
+    }
+
+    /// Erase a delegate from the invocation list, handle table and index.
+    /// @param[in] it The delegate list position.
+    void Erase(Iterator it) {
+        if (m_indexed) {
+            auto range = m_index.equal_range(it->hash);
+            for (auto index = range.first; index != range.second; ++index) {
+                if (index->second == it) {
+                    m_index.erase(index);
+                    break;
+                }
+            }
+        }
+        if (m_handled)
+            m_handles.erase(it->id);
+        m_delegates.erase(it);
+    }
+
+    /// Copy all delegate container objects. Subscription identifiers are kept.
     /// @param[in] other The container to copy from
     void CopyFrom(const MulticastDelegate& other) {
-        for (auto delegate : other.m_delegates) {
-            auto delegateClone = delegate->Clone();
+        for (const auto& entry : other.m_delegates) {
+            auto delegateClone = entry.delegate->Clone();
             if (!delegateClone)
                 BAD_ALLOC();
 
             try {
                 std::shared_ptr<DelegateType> sharedDelegate(delegateClone);
-                m_delegates.push_back(sharedDelegate);
+                Insert(std::move(sharedDelegate), entry.id);
             }
             catch (const std::bad_alloc&) {
                 BAD_ALLOC();
@@ -159,10 +326,22 @@ private:
         }
     }
 
-    /// List of registered delegates
-    xlist<std::shared_ptr<DelegateType>> m_delegates;
+    /// List of registered delegates in invocation order
+    ListType m_delegates;
+
+    /// Subscription identifier to list position. Built on first use.
+    xunordered_map<std::uint64_t, Iterator> m_handles;
+
+    /// Optional delegate hash to list position index
+    xunordered_multimap<std::size_t, Iterator> m_index;
+
+    /// `true` if `m_handles` is maintained
+    bool m_handled = false;
+
+    /// `true` if `m_index` is maintained
+    bool m_indexed = false;
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,237 @@
+#ifndef _MULTICAST_DELEGATE_INLINE_H
+#define _MULTICAST_DELEGATE_INLINE_H
+
+/// @file
+/// @brief Delegate container storing delegate instances inline within one
+/// contiguous array. Class is not thread-safe.
+///
+/// @details `MulticastDelegate<>` stores each delegate in a separately allocated list
+/// node and shared pointer. `MulticastDelegateInline<>` instead stores each delegate
+/// copy within a fixed size slot of a single array using `Delegate::CloneTo()`, so
+/// invoking the container iterates over contiguous memory without reference count
+/// updates. A delegate larger than the slot size is stored on the heap using `Clone()`
+/// and the slot holds the pointer.
+///
+/// Slot order is the insertion order. Insert, remove and array growth copy the
+/// delegates within the array. Do not insert or remove delegates from within a
+/// target function invoked by the same container.
+
+#include "Delegate.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace DelegateLib {
+
+/// Default `MulticastDelegateInline<>` slot size in bytes. Large enough to store
+/// all synchronous and non-blocking asynchronous delegate types inline.
+constexpr std::size_t DEFAULT_INLINE_DELEGATE_SIZE = 64;
+
+template <class R, std::size_t InlineSize = DEFAULT_INLINE_DELEGATE_SIZE>
+struct MulticastDelegateInline; // Not defined
+
+/// @brief Not thread-safe multicast delegate container class with inline delegate
+/// storage. When invoked, each `Delegate` instance within the invocation list is called.
+/// @tparam InlineSize The slot size in bytes used to store each delegate inline.
+template<class RetType, class... Args, std::size_t InlineSize>
+class MulticastDelegateInline<RetType(Args...), InlineSize>
+{
+public:
+    using DelegateType = Delegate<RetType(Args...)>;
+
+    MulticastDelegateInline() = default;
+    ~MulticastDelegateInline() { Clear(); }
+
+    /// @brief Copy constructor that creates a copy of the given instance.
+    /// @param[in] rhs The object to copy from.
+    MulticastDelegateInline(const MulticastDelegateInline& rhs) { CopyFrom(rhs); }
+
+    /// @brief Move constructor that transfers ownership of resources.
+    /// @param[in] rhs The object to move from.
+    MulticastDelegateInline(MulticastDelegateInline&& rhs) noexcept :
+        m_slots(std::move(rhs.m_slots)), m_size(rhs.m_size), m_capacity(rhs.m_capacity) {
+        rhs.m_size = 0;
+        rhs.m_capacity = 0;
+    }
+
+    /// Invoke all bound target functions. A void return value is used
+    /// since multiple targets invoked.
+    /// @param[in] args The arguments used when invoking the target functions
+    void operator()(Args... args) {
+        for (std::size_t i = 0; i < m_size; i++)
+            (*m_slots[i].delegate)(args...);	// Invoke delegate callback
+    }
+
+    /// Invoke all bound target functions. A void return value is used
+    /// since multiple targets invoked.
+    /// @param[in] args The arguments used when invoking the target functions
+    void Broadcast(Args... args) {
+        (*this)(args...);
+    }
+
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    void operator+=(const DelegateType& delegate) { PushBack(delegate); }
+
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    void operator+=(DelegateType&& delegate) { PushBack(delegate); }
+
+    /// Remove a delegate from the container.
+    /// @param[in] delegate A delegate target to remove
+    void operator-=(const DelegateType& delegate) { Remove(delegate); }
+
+    /// Remove a delegate from the container.
+    /// @param[in] delegate A delegate target to remove
+    void operator-=(DelegateType&& delegate) { Remove(delegate); }
+
+    /// @brief Assignment operator that assigns the state of one object to another.
+    /// @param[in] rhs The object whose state is to be assigned to the current object.
+    /// @return A reference to the current object.
+    MulticastDelegateInline& operator=(const MulticastDelegateInline& rhs) {
+        if (&rhs != this) {
+            Clear();
+            CopyFrom(rhs);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator that transfers ownership of resources.
+    /// @param[in] rhs The object to move from.
+    /// @return A reference to the current object.
+    MulticastDelegateInline& operator=(MulticastDelegateInline&& rhs) noexcept {
+        if (&rhs != this) {
+            Clear();
+            m_slots = std::move(rhs.m_slots);
+            m_size = rhs.m_size;
+            m_capacity = rhs.m_capacity;
+            rhs.m_size = 0;
+            rhs.m_capacity = 0;
+        }
+        return *this;
+    }
+
+    /// @brief Clear the all target functions.
+    virtual void operator=(std::nullptr_t) noexcept { Clear(); }
+
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    void PushBack(const DelegateType& delegate) {
+        if (m_size == m_capacity)
+            Reserve(m_capacity == 0 ? 4 : m_capacity * 2);
+        m_slots[m_size].Assign(delegate);
+        m_size++;
+    }
+
+    /// Remove a delegate into the container.
+    /// @param[in] delegate The delegate target to remove.
+    void Remove(const DelegateType& delegate) {
+        for (std::size_t i = 0; i < m_size; i++) {
+            if (*m_slots[i].delegate == delegate) {
+                // Shift the following delegates down to preserve the order
+                for (std::size_t j = i + 1; j < m_size; j++)
+                    m_slots[j - 1].Move(m_slots[j]);
+                m_size--;
+                m_slots[m_size].Reset();
+                return;
+            }
+        }
+    }
+
+    /// Any registered delegates?
+    /// @return `true` if delegate container is empty.
+    bool Empty() const { return m_size == 0; }
+
+    /// Removal all registered delegates.
+    void Clear() {
+        for (std::size_t i = 0; i < m_size; i++)
+            m_slots[i].Reset();
+        m_size = 0;
+    }
+
+    /// Get the number of delegates stored.
+    /// @return The number of delegates stored.
+    std::size_t Size() const { return m_size; }
+
+    /// @brief Implicit conversion operator to `bool`.
+    /// @return `true` if the container is not empty, `false` if the container is empty.
+    explicit operator bool() const { return !Empty(); }
+
+private:
+    /// @brief Storage for one delegate instance, inline or on the heap.
+    struct Slot {
+        alignas(std::max_align_t) unsigned char buffer[InlineSize];
+        DelegateType* delegate = nullptr;
+        bool isInline = false;
+
+        /// Store a copy of a delegate. The slot must be empty.
+        void Assign(const DelegateType& rhs) {
+            delegate = rhs.CloneTo(buffer, InlineSize);
+            isInline = (delegate != nullptr);
+            if (!delegate) {
+                delegate = rhs.Clone();
+                if (!delegate)
+                    BAD_ALLOC();
+            }
+        }
+
+        /// Move the delegate from another slot. This slot is reset first.
+        void Move(Slot& rhs) {
+            Reset();
+            if (rhs.isInline) {
+                Assign(*rhs.delegate);
+                rhs.Reset();
+            }
+            else {
+                delegate = rhs.delegate;
+                rhs.delegate = nullptr;
+            }
+        }
+
+        /// Destroy the stored delegate.
+        void Reset() {
+            if (delegate) {
+                if (isInline)
+                    delegate->~DelegateType();
+                else
+                    delete delegate;
+            }
+            delegate = nullptr;
+            isInline = false;
+        }
+    };
+
+    /// Grow the slot array.
+    /// @param[in] capacity The new capacity.
+    void Reserve(std::size_t capacity) {
+        std::unique_ptr<Slot[]> slots(new(std::nothrow) Slot[capacity]);
+        if (!slots)
+            BAD_ALLOC();
+
+        for (std::size_t i = 0; i < m_size; i++)
+            slots[i].Move(m_slots[i]);
+        m_slots = std::move(slots);
+        m_capacity = capacity;
+    }
+
+    /// Copy all delegate container objects.
+    /// @param[in] other The container to copy from
+    void CopyFrom(const MulticastDelegateInline& other) {
+        if (other.m_size > m_capacity)
+            Reserve(other.m_size);
+        for (std::size_t i = 0; i < other.m_size; i++) {
+            m_slots[i].Assign(*other.m_slots[i].delegate);
+            m_size++;
+        }
+    }
+
+    /// Contiguous array of delegate slots
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = 0;
+};
+
+}
+
+#endif
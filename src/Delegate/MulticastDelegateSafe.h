@@ -2,27 +2,45 @@
 #define _MULTICAST_DELEGATE_SAFE_H
 
 /// @file
-/// @brief Delegate container for storing and iterating over a collection of 
+/// @brief Delegate container for storing and iterating over a collection of
 /// delegate instances. Class is thread-safe.
-
-#include "MulticastDelegate.h"
+///
+/// @details The invocation list is copy-on-write. Each invocation loads an immutable
+/// snapshot of the list and invokes the delegates without holding a lock. Insert and
+/// remove create a new list under a writer lock and publish it atomically. Therefore:
+///
+/// * A slow target function does not block other publishers or `+=`/`-=` callers.
+/// * A target function may insert or remove delegates, including itself, from within
+///   the callback. The change takes effect on the next invocation.
+/// * A removed delegate is kept alive until all invocations using it complete, so a
+///   target function may still be called once after removal by a concurrent invocation.
+///
+/// Concurrent invocations may call the same stored delegate instance at once. Each
+/// `DelegateAsyncWait` call waits on its own message, so a broadcast from multiple
+/// threads is race free; `IsSuccess()` only reports the most recent call outcome.
+
+#include "Delegate.h"
+#include <list>
+#include <algorithm>
+#include <memory>
 #include <mutex>
+#include <atomic>
 
 namespace DelegateLib {
 
 template <class R>
 struct MulticastDelegateSafe; // Not defined
 
-/// @brief Thread-safe multicast delegate container class. 
+/// @brief Thread-safe multicast delegate container class.
 template<class RetType, class... Args>
-class MulticastDelegateSafe<RetType(Args...)> : public MulticastDelegate<RetType(Args...)>
+class MulticastDelegateSafe<RetType(Args...)>
 {
 public:
     using DelegateType = Delegate<RetType(Args...)>;
-    using BaseType = MulticastDelegate<RetType(Args...)>;
+    using ListType = xlist<std::shared_ptr<DelegateType>>;
 
     MulticastDelegateSafe() = default;
-    ~MulticastDelegateSafe() = default; 
+    ~MulticastDelegateSafe() = default;
     MulticastDelegateSafe(const MulticastDelegateSafe& rhs) = delete;
     MulticastDelegateSafe(MulticastDelegateSafe&& rhs) = delete;
 
@@ -30,52 +48,51 @@ public:
     /// A void return value is used since multiple targets invoked.
     /// @param[in] args The arguments used when invoking the target functions
     void operator()(Args... args) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator ()(args...);
+        auto snapshot = Load();
+        if (!snapshot)
+            return;
+        for (auto& delegate : *snapshot)
+            (*delegate)(args...);	// Invoke delegate callback
     }
 
-    /// Invoke all bound target functions. A void return value is used 
+    /// Invoke all bound target functions. A void return value is used
     /// since multiple targets invoked.
     /// @param[in] args The arguments used when invoking the target functions
     void Broadcast(Args... args) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::Broadcast(args...);
+        (*this)(args...);
     }
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
-    void operator+=(const Delegate<RetType(Args...)>& delegate) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator +=(delegate);
-    }
+    void operator+=(const Delegate<RetType(Args...)>& delegate) { PushBack(delegate); }
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
-    void operator+=(Delegate<RetType(Args...)>&& delegate) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator +=(delegate);
-    }
+    void operator+=(Delegate<RetType(Args...)>&& delegate) { PushBack(delegate); }
 
     /// Remove a delegate from the container.
     /// @param[in] delegate A delegate target to remove
-    void operator-=(const Delegate<RetType(Args...)>& delegate) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator -=(delegate);
-    }
+    void operator-=(const Delegate<RetType(Args...)>& delegate) { Remove(delegate); }
 
     /// Remove a delegate from the container.
     /// @param[in] delegate A delegate target to remove
-    void operator-=(Delegate<RetType(Args...)>&& delegate) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator -=(delegate);
-    }
+    void operator-=(Delegate<RetType(Args...)>&& delegate) { Remove(delegate); }
 
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
     MulticastDelegateSafe& operator=(const MulticastDelegateSafe& rhs) {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator=(rhs);
+        if (&rhs != this) {
+            auto snapshot = rhs.Load();
+            std::shared_ptr<ListType> list;
+            if (snapshot) {
+                list = NewList();
+                for (auto& delegate : *snapshot)
+                    list->push_back(CloneShared(*delegate));
+            }
+            const std::lock_guard<std::mutex> lock(m_lock);
+            Store(std::move(list));
+        }
         return *this;
     }
 
@@ -83,61 +100,139 @@ public:
     /// @param[in] rhs The object to move from.
     /// @return A reference to the current object.
     MulticastDelegateSafe& operator=(MulticastDelegateSafe&& rhs) noexcept {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        BaseType::operator=(std::forward<MulticastDelegateSafe>(rhs));
+        if (&rhs != this) {
+            std::shared_ptr<const ListType> snapshot;
+            {
+                const std::lock_guard<std::mutex> lock(rhs.m_lock);
+                snapshot = rhs.Load();
+                rhs.Store(nullptr);
+            }
+            const std::lock_guard<std::mutex> lock(m_lock);
+            Store(std::move(snapshot));
+        }
         return *this;
     }
 
     /// @brief Clear the all target functions.
-    virtual void operator=(std::nullptr_t) noexcept { 
-        const std::lock_guard<std::mutex> lock(m_lock);
-        return BaseType::Clear(); 
-    }
+    virtual void operator=(std::nullptr_t) noexcept { Clear(); }
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
     void PushBack(const DelegateType& delegate) {
+        auto sharedDelegate = CloneShared(delegate);
+
         const std::lock_guard<std::mutex> lock(m_lock);
-        return BaseType::PushBack(delegate);
+        auto snapshot = Load();
+        auto list = snapshot ? NewList(*snapshot) : NewList();
+        list->push_back(std::move(sharedDelegate));
+        Store(std::move(list));
     }
 
     /// Remove a delegate into the container.
     /// @param[in] delegate The delegate target to remove.
     void Remove(const DelegateType& delegate) {
         const std::lock_guard<std::mutex> lock(m_lock);
-        return BaseType::Remove(delegate);
+        auto snapshot = Load();
+        if (!snapshot)
+            return;
+
+        // Use std::find_if to locate the matching delegate
+        auto it = std::find_if(snapshot->begin(), snapshot->end(),
+            [&delegate](const std::shared_ptr<DelegateType>& item) {
+                return *item == delegate;
+            });
+        if (it == snapshot->end())
+            return;
+
+        // Publish a new list without the delegate
+        auto list = NewList(*snapshot);
+        list->erase(std::next(list->begin(), std::distance(snapshot->begin(), it)));
+        if (list->empty())
+            list = nullptr;
+        Store(std::move(list));
     }
 
     /// Any registered delegates?
     /// @return `true` if delegate container is empty.
-    bool Empty() {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        return BaseType::Empty();
+    bool Empty() const {
+        auto snapshot = Load();
+        return !snapshot || snapshot->empty();
     }
 
     /// Removal all registered delegates.
     void Clear() {
-       const std::lock_guard<std::mutex> lock(m_lock);
-       BaseType::Clear();
+        const std::lock_guard<std::mutex> lock(m_lock);
+        Store(nullptr);
     }
 
     /// Get the number of delegates stored.
     /// @return The number of delegates stored.
-    std::size_t Size() { 
-        const std::lock_guard<std::mutex> lock(m_lock);
-        return BaseType::Size(); 
+    std::size_t Size() const {
+        auto snapshot = Load();
+        return snapshot ? snapshot->size() : 0;
     }
 
     /// @brief Implicit conversion operator to `bool`.
     /// @return `true` if the container is not empty, `false` if the container is empty.
-    explicit operator bool() {
-        const std::lock_guard<std::mutex> lock(m_lock);
-        return BaseType::operator bool();
-    }
+    explicit operator bool() const { return !Empty(); }
 
 private:
-    /// Lock to make the class thread-safe
+    /// Clone a delegate into a shared pointer.
+    static std::shared_ptr<DelegateType> CloneShared(const DelegateType& delegate) {
+        auto delegateClone = delegate.Clone();
+        if (!delegateClone)
+            BAD_ALLOC();
+
+        try {
+            return std::shared_ptr<DelegateType>(delegateClone);
+        }
+        catch (const std::bad_alloc&) {
+            BAD_ALLOC();
+        }
+        return nullptr;
+    }
+
+    /// Create a new invocation list.
+    template <typename... ListArgs>
+    static std::shared_ptr<ListType> NewList(ListArgs&&... listArgs) {
+        try {
+            return xmake_shared<ListType>(std::forward<ListArgs>(listArgs)...);
+        }
+        catch (const std::bad_alloc&) {
+            BAD_ALLOC();
+        }
+        return nullptr;
+    }
+
+    /// Get the current invocation list snapshot.
+    /// @return The immutable invocation list, or `nullptr` if empty.
+    std::shared_ptr<const ListType> Load() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_delegates.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&m_delegates, std::memory_order_acquire);
+#endif
+    }
+
+    /// Publish a new invocation list snapshot. Called with m_lock held.
+    /// @param[in] list The new invocation list, or `nullptr` if empty.
+    void Store(std::shared_ptr<const ListType> list) {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        m_delegates.store(std::move(list), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&m_delegates, std::move(list), std::memory_order_release);
+#endif
+    }
+
+    /// Writer lock to serialize invocation list updates
     std::mutex m_lock;
+
+    /// Immutable invocation list snapshot. Accessed atomically.
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const ListType>> m_delegates;
+#else
+    std::shared_ptr<const ListType> m_delegates;
+#endif
 };
 
 }
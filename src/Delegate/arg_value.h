@@ -0,0 +1,133 @@
+#ifndef _ARG_VALUE_H
+#define _ARG_VALUE_H
+
+/// @file
+/// @brief Helper classes for storing copies of function arguments by value.
+///
+/// @details The `arg_value<>` classes store a decayed copy of a function argument
+/// for transport through a thread message queue. A tuple of `arg_value<>` elements
+/// is constructed in place within the message, so no additional dynamic storage
+/// allocation is required per argument.
+///
+/// Pointer, pointer-to-pointer and reference arguments are rebound to the stored
+/// copy when `get()` is called by the destination thread:
+///
+/// * `T` - the stored value is moved to the target function.
+/// * `T&` - a reference to the stored value.
+/// * `T*` - a pointer to the stored value, or `nullptr` if the source argument was `nullptr`.
+/// * `T**` - a pointer to a pointer to the stored value. The inner pointer is `nullptr` if
+///   the source argument, or the pointer it points to, was `nullptr`.
+///
+/// See `Invoke()` and `DelegateAsyncMsg()` in the file `DelegateAsync.h` for example usage.
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace DelegateLib
+{
+
+/// @brief Stores a by value function argument.
+/// @tparam T The function argument type.
+template <class T>
+class arg_value
+{
+public:
+    static_assert(!std::is_rvalue_reference_v<T>, "rvalue reference argument not allowed");
+    static_assert(!std::is_same_v<std::decay_t<T>, void*>, "void* argument not allowed");
+
+    using value_type = std::remove_cv_t<T>;
+    using arg_type = value_type&&;
+
+    template <class U>
+    arg_value(U&& arg) : m_value(std::forward<U>(arg)) {}
+
+    arg_value(const arg_value&) = delete;
+    arg_value& operator=(const arg_value&) = delete;
+
+    /// Get the argument to pass to the target function. Call once.
+    arg_type get() { return std::move(m_value); }
+
+private:
+    value_type m_value;
+};
+
+/// @brief Stores a copy of a reference function argument.
+/// @tparam T The referenced argument type.
+template <class T>
+class arg_value<T&>
+{
+public:
+    using value_type = std::remove_cv_t<T>;
+    using arg_type = T&;
+
+    arg_value(T& arg) : m_value(arg) {}
+
+    arg_value(const arg_value&) = delete;
+    arg_value& operator=(const arg_value&) = delete;
+
+    /// Get a reference to the stored argument copy.
+    arg_type get() { return m_value; }
+
+private:
+    value_type m_value;
+};
+
+/// @brief Stores a copy of the data pointed to by a pointer function argument.
+/// @tparam T The pointed to argument type.
+template <class T>
+class arg_value<T*>
+{
+public:
+    static_assert(!std::is_void_v<T>, "void* argument not allowed");
+
+    using value_type = std::remove_cv_t<T>;
+    using arg_type = T*;
+
+    arg_value(T* arg) {
+        if (arg != nullptr)
+            m_value.emplace(*arg);
+    }
+
+    arg_value(const arg_value&) = delete;
+    arg_value& operator=(const arg_value&) = delete;
+
+    /// Get a pointer to the stored argument copy.
+    /// @return A pointer to the copy, or `nullptr` if the source argument was `nullptr`.
+    arg_type get() { return m_value ? &*m_value : nullptr; }
+
+private:
+    std::optional<value_type> m_value;
+};
+
+/// @brief Stores a copy of the data pointed to by a pointer-to-pointer function argument.
+/// @tparam T The pointed to argument type.
+template <class T>
+class arg_value<T**>
+{
+public:
+    using value_type = std::remove_cv_t<T>;
+    using arg_type = T**;
+
+    arg_value(T** arg) {
+        if (arg != nullptr && *arg != nullptr) {
+            m_value.emplace(**arg);
+            m_ptr = &*m_value;
+        }
+    }
+
+    // Not copyable since m_ptr points to m_value
+    arg_value(const arg_value&) = delete;
+    arg_value& operator=(const arg_value&) = delete;
+
+    /// Get a pointer to the pointer to the stored argument copy.
+    arg_type get() { return &m_ptr; }
+
+private:
+    std::optional<value_type> m_value;
+    T* m_ptr = nullptr;
+};
+
+}
+
+#endif
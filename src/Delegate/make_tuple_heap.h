@@ -14,8 +14,8 @@
 /// pointer, pointer-to-pointer, and reference.
 /// 
 /// The destination thread uses `std::apply()` to invoke the target function using
-/// the tuple of arguments. See `Invoke()` and `DelegateAsyncMsg()` in the
-/// file `DelegateAsync.h` for example usage.
+/// the tuple of arguments. `DelegateAsyncMsg` stores arguments by value within the
+/// message instead. See `arg_value.h`.
 
 #include <tuple>
 #include <list>
@@ -1,12 +1,13 @@
 /// @file
-/// @brief A std::async thread targeting example. Use std::async and std::future with 
-/// delegates allows the main thread to continue while the specified target thread completes. 
+/// @brief A future thread targeting example. Using `AsyncInvokeFuture()` allows the main 
+/// thread to continue while the specified target thread completes, without blocking an 
+/// additional thread waiting for the result. 
 
 #include "AsyncFuture.h"
 #include "DelegateLib.h"
 #include "WorkerThreadStd.h"
 #include <iostream>
-#include <future>
+#include <optional>
 #include <chrono>
 
 using namespace DelegateLib;
@@ -27,11 +28,10 @@ void AsyncFutureExample()
     comm_thread.CreateThread();
 
     // Create an async delegate targeted at send_data()
-    auto send_data_delegate = MakeDelegate(&send_data, comm_thread, WAIT_INFINITE);
+    auto send_data_delegate = MakeDelegate(&send_data, comm_thread);
 
-    // Start the asynchronous task using std::async. send_data() will be called on 
-    // comm_thread context.
-    std::future<size_t> result = std::async(std::launch::async, send_data_delegate, "send_data message");
+    // Start the asynchronous call. send_data() will be called on comm_thread context.
+    DelegateFuture<size_t> result = send_data_delegate.AsyncInvokeFuture("send_data message");
 
     // Do other work while send_data() is executing on comm_thread
     std::cout << "Doing other work in main thread while data is sent...\n";
@@ -40,8 +40,14 @@ void AsyncFutureExample()
     std::this_thread::sleep_for(std::chrono::seconds(1));
 
     // Get bytes sent. This will block until send_data() completes.
-    size_t bytes_sent = result.get(); 
+    std::optional<size_t> bytes_sent = result.Get();
+    if (bytes_sent)
+        std::cout << "Result from send_data: " << *bytes_sent << std::endl;
+
+    // Chain a continuation invoked on comm_thread once send_data() completes
+    send_data_delegate.AsyncInvokeFuture("second message").Then([](size_t sent) {
+        std::cout << "Continuation bytes sent: " << sent << std::endl;
+    }).Wait();
 
-    std::cout << "Result from send_data: " << bytes_sent << std::endl;
     comm_thread.ExitThread();
 }
@@ -1,7 +1,7 @@
 #ifndef _ASYNC_FUTURE_H
 #define _ASYNC_FUTURE_H
 
-/// Execute the std::async and std::future with delegates example
+/// Execute the AsyncInvokeFuture() with delegates example
 void AsyncFutureExample();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+/// @file
+/// @brief Await asynchronous delegates within C++20 coroutines. The coroutine suspends 
+/// while the target function executes on another worker thread and resumes on its own 
+/// worker thread without blocking any thread.
+
+#include "Coroutine.h"
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include <iostream>
+#include <chrono>
+
+#if defined(_MSVC_LANG) && _MSVC_LANG >= 202002L || __cplusplus >= 202002L
+
+#include <coroutine>
+#include <latch>
+#include <string>
+
+using namespace DelegateLib;
+using namespace std;
+
+static WorkerThread ui_thread("UiThread");
+static WorkerThread comm_thread("CommunicationThread");
+
+// A minimal fire and forget coroutine return type
+struct FireAndForget
+{
+    struct promise_type
+    {
+        FireAndForget get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// Assume send_data() may only be called on comm_thread context
+static size_t send_data(const std::string& data)
+{
+    std::cout << "send_data() on " << WorkerThread::GetCurrentWorkerThread()->GetThreadName() << std::endl;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));  // Simulate sending
+    return data.size();
+}
+
+// Coroutine running on ui_thread. Each co_await suspends while send_data() executes 
+// on comm_thread, then resumes on ui_thread. ui_thread is free to process other 
+// messages while suspended.
+static std::latch done(1);
+
+static FireAndForget send_messages()
+{
+    auto send_data_delegate = MakeDelegate(&send_data, comm_thread, WAIT_INFINITE);
+
+    size_t total = 0;
+    for (const char* message : { "first message", "second message" })
+    {
+        total += co_await AsyncAwait(send_data_delegate, message);
+        std::cout << "Resumed on " << WorkerThread::GetCurrentWorkerThread()->GetThreadName() << std::endl;
+    }
+    std::cout << "Total bytes sent: " << total << std::endl;
+    done.count_down();
+}
+
+static void start_send_messages()
+{
+    send_messages();
+}
+
+void CoroutineExample()
+{
+    ui_thread.CreateThread();
+    comm_thread.CreateThread();
+
+    // Start the coroutine on ui_thread
+    MakeDelegate(&start_send_messages, ui_thread).AsyncInvoke();
+    done.wait();
+
+    ui_thread.ExitThread();
+    comm_thread.ExitThread();
+}
+#else
+void CoroutineExample() {}
+#endif
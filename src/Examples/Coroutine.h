@@ -0,0 +1,7 @@
+#ifndef _COROUTINE_H
+#define _COROUTINE_H
+
+/// Execute the C++20 coroutine with delegates example
+void CoroutineExample();
+
+#endif
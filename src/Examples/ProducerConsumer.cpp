@@ -19,7 +19,11 @@ public:
         return instance;
     }
 
-    Consumer() : m_thread("Consumer") { m_thread.CreateThread(); }
+    Consumer() : m_thread("Consumer") { 
+        // Bound the queue so a fast producer blocks instead of growing memory
+        m_thread.SetMaxQueueSize(100, WorkerThread::FullPolicy::BLOCK);
+        m_thread.CreateThread(); 
+    }
     ~Consumer() { m_thread.ExitThread(); }
 
     /// Process data from any producer
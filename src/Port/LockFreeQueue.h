@@ -0,0 +1,106 @@
+#ifndef _LOCK_FREE_QUEUE_H
+#define _LOCK_FREE_QUEUE_H
+
+/// @file
+/// @brief Intrusive lock-free multiple producer, single consumer delegate message queue.
+///
+/// @details The queue links messages through the `DelegateMsgLink` embedded within each
+/// `DelegateMsg`, so pushing a message does not allocate. Producers use a single atomic
+/// exchange; the consumer never blocks producers. Based on the Dmitry Vyukov intrusive
+/// MPSC node-based queue.
+///
+/// `Push()` may be called by any thread. `Pop()` and `Empty()` must only be called by
+/// the single consumer thread.
+
+#include "DelegateMsg.h"
+#include <atomic>
+#include <memory>
+
+class LockFreeQueue
+{
+public:
+    LockFreeQueue() : m_head(&m_stub), m_tail(&m_stub) {}
+
+    ~LockFreeQueue()
+    {
+        // Release any messages remaining in the queue
+        while (Pop() || !Empty()) {}
+    }
+
+    /// Add a message to the queue. Called by any producer thread.
+    /// @param[in] msg - the message to add.
+    void Push(std::shared_ptr<DelegateLib::DelegateMsg> msg)
+    {
+        DelegateLib::DelegateMsgLink* link = &msg->GetLink();
+        link->msg = std::move(msg);
+        Push(link);
+    }
+
+    /// Remove the oldest message from the queue. Called by the consumer thread.
+    /// @return The oldest message, or `nullptr` if none is available. A `nullptr`
+    /// return with `Empty()` false means a producer is mid-push; try again shortly.
+    std::shared_ptr<DelegateLib::DelegateMsg> Pop()
+    {
+        DelegateLib::DelegateMsgLink* tail = m_tail;
+        DelegateLib::DelegateMsgLink* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &m_stub)
+        {
+            if (next == nullptr)
+                return nullptr;
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return Release(tail);
+        }
+        if (tail != m_head.load())
+            return nullptr;
+
+        // Tail is the last message. Push the stub so the tail can be removed.
+        Push(&m_stub);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return Release(tail);
+        }
+        return nullptr;
+    }
+
+    /// Check if the queue is empty. Called by the consumer thread.
+    /// @return `true` if no message is queued or being pushed.
+    bool Empty() const
+    {
+        return m_tail == &m_stub && m_head.load() == &m_stub;
+    }
+
+private:
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    void Push(DelegateLib::DelegateMsgLink* link)
+    {
+        link->next.store(nullptr, std::memory_order_relaxed);
+        DelegateLib::DelegateMsgLink* prev = m_head.exchange(link);
+        prev->next.store(link, std::memory_order_release);
+    }
+
+    static std::shared_ptr<DelegateLib::DelegateMsg> Release(DelegateLib::DelegateMsgLink* link)
+    {
+        return std::move(link->msg);
+    }
+
+    /// Most recently pushed link. Shared by all producers.
+    alignas(64) std::atomic<DelegateLib::DelegateMsgLink*> m_head;
+
+    /// Oldest link. Owned by the consumer.
+    alignas(64) DelegateLib::DelegateMsgLink* m_tail;
+
+    /// Placeholder link used when the queue is empty
+    DelegateLib::DelegateMsgLink m_stub;
+};
+
+#endif
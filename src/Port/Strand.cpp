@@ -0,0 +1,67 @@
+#include "DelegateOpt.h"
+#include "Strand.h"
+#include "Fault.h"
+#include <thread>
+
+using namespace std;
+using namespace DelegateLib;
+
+//----------------------------------------------------------------------------
+// Strand
+//----------------------------------------------------------------------------
+Strand::Strand(DelegateThread& pool, size_t maxBatchSize) :
+	m_pool(pool), m_pending(0),
+	m_scheduleMsg(std::make_shared<DelegateMsg>(std::shared_ptr<IDelegateInvoker>(std::shared_ptr<IDelegateInvoker>(), this))),
+	m_maxBatchSize(maxBatchSize > 0 ? maxBatchSize : 1)
+{
+}
+
+//----------------------------------------------------------------------------
+// DispatchDelegate
+//----------------------------------------------------------------------------
+void Strand::DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg)
+{
+	RecordDispatch(*msg);
+	m_queue.Push(std::move(msg));
+
+	// The first message queued to an idle strand schedules the strand
+	if (m_pending.fetch_add(1) == 0)
+		m_pool.DispatchDelegate(m_scheduleMsg);
+}
+
+//----------------------------------------------------------------------------
+// Invoke
+//----------------------------------------------------------------------------
+bool Strand::Invoke(std::shared_ptr<DelegateLib::DelegateMsg>)
+{
+	DelegateThread* previous = GetCurrent();
+	SetCurrent(this);
+
+	for (size_t i = 0; i < m_maxBatchSize; i++)
+	{
+		// The pending count is non-zero so a message is queued or a producer is mid-push
+		auto msg = m_queue.Pop();
+		while (!msg)
+		{
+			std::this_thread::yield();
+			msg = m_queue.Pop();
+		}
+
+		// Invoke the delegate destination target function
+		bool success = InvokeDelegate(msg);
+		ASSERT_TRUE(success);
+		msg = nullptr;
+
+		// Strand is idle once the last pending message is invoked
+		if (m_pending.fetch_sub(1) == 1)
+		{
+			SetCurrent(previous);
+			return true;
+		}
+	}
+
+	// Batch limit reached. Reschedule behind other work queued to the pool.
+	SetCurrent(previous);
+	m_pool.DispatchDelegate(m_scheduleMsg);
+	return true;
+}
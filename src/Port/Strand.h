@@ -0,0 +1,78 @@
+#ifndef _STRAND_H
+#define _STRAND_H
+
+/// @file
+/// @brief A serialized `DelegateThread` that borrows threads from a shared pool.
+///
+/// @details A `Strand` guarantees that messages dispatched to it are invoked one at a
+/// time in FIFO order, like a dedicated `WorkerThread`, without owning an OS thread.
+/// `DispatchDelegate()` pushes the message onto an intrusive lock-free queue. The first
+/// message queued to an idle strand schedules the strand onto the pool. A pool thread
+/// then invokes the queued messages until the strand is empty, or until a batch limit
+/// is reached and the strand reschedules itself behind other pool work.
+///
+/// Thousands of strands may share a handful of pool threads, for instance a
+/// `ThreadPool`, giving each active object lock-free serialized access to its own
+/// state. While a strand invokes a message, `DelegateThread::GetCurrent()` returns
+/// the strand.
+///
+/// The strand must outlive any message dispatched to it. The pool must not be exited
+/// while the strand has messages queued.
+
+#include "DelegateOpt.h"
+#include "DelegateThread.h"
+#include "DelegateInvoker.h"
+#include "LockFreeQueue.h"
+#include <atomic>
+#include <memory>
+
+class Strand : public DelegateLib::DelegateThread, public DelegateLib::IDelegateInvoker
+{
+public:
+	/// Default maximum number of messages invoked before rescheduling onto the pool
+	static const size_t DEFAULT_MAX_BATCH_SIZE = 64;
+
+	/// Constructor
+	/// @param[in] pool - the thread or thread pool that executes the strand.
+	/// @param[in] maxBatchSize - the maximum number of messages invoked each time
+	/// the strand is scheduled. Must be greater than 0.
+	Strand(DelegateLib::DelegateThread& pool, size_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE);
+
+	/// Destructor
+	~Strand() = default;
+
+	/// Get the number of messages queued or being invoked
+	size_t GetQueueSize() { return m_pending.load(); }
+
+	/// Get the name of the thread or thread pool that executes the strand
+	virtual std::string GetThreadName() { return m_pool.GetThreadName(); }
+
+	virtual void DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg);
+
+	/// Called by the pool thread to invoke a batch of queued messages.
+	/// @param[in] msg - the strand schedule message.
+	/// @return `true` always.
+	virtual bool Invoke(std::shared_ptr<DelegateLib::DelegateMsg> msg);
+
+private:
+	Strand(const Strand&) = delete;
+	Strand& operator=(const Strand&) = delete;
+
+	/// The thread or thread pool that executes the strand
+	DelegateLib::DelegateThread& m_pool;
+
+	/// Messages waiting to be invoked. Only the pool thread currently executing
+	/// the strand consumes.
+	LockFreeQueue m_queue;
+
+	/// Number of messages queued or being invoked. The strand is scheduled onto
+	/// the pool while non-zero.
+	std::atomic<size_t> m_pending;
+
+	/// Message dispatched onto the pool to schedule the strand
+	const std::shared_ptr<DelegateLib::DelegateMsg> m_scheduleMsg;
+
+	const size_t m_maxBatchSize;
+};
+
+#endif
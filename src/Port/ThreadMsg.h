@@ -1,11 +1,17 @@
 #ifndef _THREAD_MSG_H
 #define _THREAD_MSG_H
 
+#include "DelegateMsg.h"
+#include <memory>
+
 /// @brief A class to hold a platform-specific thread messsage that will be passed 
-/// through the OS message queue. 
+/// through the OS message queue. Stored by value within the queue so no additional 
+/// allocation is required per message.
 class ThreadMsg
 {
 public:
+	ThreadMsg() = default;
+
 	/// Constructor
 	/// @param[in] id - a unique identifier for the thread messsage
 	/// @param[in] data - a pointer to the messsage data to be typecast
@@ -15,7 +21,7 @@ public:
 	///		callback is complete.  
 	ThreadMsg(int id, std::shared_ptr<DelegateLib::DelegateMsg> data) :
 		m_id(id), 
-		m_data(data)
+		m_data(std::move(data))
 	{
 	}
 
@@ -23,7 +29,7 @@ public:
     std::shared_ptr<DelegateLib::DelegateMsg> GetData() { return m_data; }
 
 private:
-	int m_id;
+	int m_id = 0;
     std::shared_ptr<DelegateLib::DelegateMsg> m_data;
 };
 
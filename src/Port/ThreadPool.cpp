@@ -0,0 +1,260 @@
+#include "DelegateOpt.h"
+#include "ThreadPool.h"
+#include "Fault.h"
+#include <functional>
+
+#ifdef WIN32
+#include <Windows.h>
+#endif
+
+using namespace std;
+using namespace DelegateLib;
+
+// The pool and worker index of the currently executing worker thread
+static thread_local ThreadPool* t_currentPool = nullptr;
+static thread_local size_t t_currentIndex = 0;
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+ThreadPool::ThreadPool(const std::string& poolName, size_t numThreads) :
+	m_next(0), m_queueSize(0), m_stealable(0), m_idleCnt(0), m_stealCnt(0),
+	m_exit(false), m_created(false), m_ordered(*this), POOL_NAME(poolName)
+{
+	if (numThreads == 0)
+		numThreads = 1;
+	for (size_t i = 0; i < numThreads; i++)
+		m_workers.push_back(std::unique_ptr<Worker>(new Worker()));
+}
+
+//----------------------------------------------------------------------------
+// ~ThreadPool
+//----------------------------------------------------------------------------
+ThreadPool::~ThreadPool()
+{
+	ExitThread();
+}
+
+//----------------------------------------------------------------------------
+// CreateThread
+//----------------------------------------------------------------------------
+bool ThreadPool::CreateThread()
+{
+	if (!m_created)
+	{
+		m_exit = false;
+		m_created = true;
+		for (size_t i = 0; i < m_workers.size(); i++)
+		{
+			m_workers[i]->thread = std::unique_ptr<std::thread>(new thread(&ThreadPool::Process, this, i));
+
+#ifdef WIN32
+			// Set the thread name so it shows in the Visual Studio Debug Location toolbar
+			std::string name = POOL_NAME + std::to_string(i);
+			std::wstring wstr(name.begin(), name.end());
+			SetThreadDescription(m_workers[i]->thread->native_handle(), wstr.c_str());
+#endif
+		}
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+// ExitThread
+//----------------------------------------------------------------------------
+void ThreadPool::ExitThread()
+{
+	if (!m_created)
+		return;
+
+	// Each worker invokes its queued messages then exits
+	m_exit = true;
+	for (auto& worker : m_workers)
+	{
+		{
+			lock_guard<mutex> lk(worker->lock);
+		}
+		worker->cv.notify_one();
+	}
+	for (auto& worker : m_workers)
+	{
+		worker->thread->join();
+		worker->thread = nullptr;
+	}
+	m_created = false;
+}
+
+//----------------------------------------------------------------------------
+// DispatchDelegate
+//----------------------------------------------------------------------------
+void ThreadPool::DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg)
+{
+	Dispatch(std::move(msg), false);
+}
+
+//----------------------------------------------------------------------------
+// Dispatch
+//----------------------------------------------------------------------------
+void ThreadPool::Dispatch(std::shared_ptr<DelegateLib::DelegateMsg> msg, bool ordered)
+{
+	if (!m_created)
+		throw std::invalid_argument("Thread pointer is null");
+
+	// A worker dispatching onto its own pool keeps the message local. An ordered
+	// message is always queued to the same worker for a given producer thread.
+	size_t index;
+	if (t_currentPool == this)
+		index = t_currentIndex;
+	else if (ordered)
+		index = std::hash<std::thread::id>()(this_thread::get_id()) % m_workers.size();
+	else
+		index = m_next++ % m_workers.size();
+
+	Worker& worker = *m_workers[index];
+	bool notify;
+	RecordDispatch(*msg);
+	{
+		lock_guard<mutex> lk(worker.lock);
+
+		// The pool is exiting and only invokes messages queued before ExitThread(). 
+		// Checked under the worker lock so a worker that already exited never misses 
+		// a queued message.
+		if (m_exit)
+		{
+			msg->TryDiscard();
+			RecordDiscard(*msg);
+			return;
+		}
+
+		m_queueSize++;
+		if (ordered)
+		{
+			worker.ordered.push_back(std::move(msg));
+		}
+		else
+		{
+			worker.deque.push_back(std::move(msg));
+			m_stealable++;
+		}
+		notify = worker.sleeping;
+	}
+
+	if (notify)
+		worker.cv.notify_one();
+	else if (!ordered && m_idleCnt.load() > 0)
+		WakeIdle();
+}
+
+//----------------------------------------------------------------------------
+// WakeIdle
+//----------------------------------------------------------------------------
+void ThreadPool::WakeIdle()
+{
+	for (auto& worker : m_workers)
+	{
+		unique_lock<mutex> lk(worker->lock);
+		if (worker->sleeping)
+		{
+			lk.unlock();
+			worker->cv.notify_one();
+			return;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+// Pop
+//----------------------------------------------------------------------------
+std::shared_ptr<DelegateLib::DelegateMsg> ThreadPool::Pop(size_t index)
+{
+	Worker& worker = *m_workers[index];
+	lock_guard<mutex> lk(worker.lock);
+
+	worker.preferOrdered = !worker.preferOrdered;
+	if (!worker.ordered.empty() && (worker.preferOrdered || worker.deque.empty()))
+	{
+		auto msg = std::move(worker.ordered.front());
+		worker.ordered.pop_front();
+		return msg;
+	}
+	if (!worker.deque.empty())
+	{
+		auto msg = std::move(worker.deque.front());
+		worker.deque.pop_front();
+		m_stealable--;
+		return msg;
+	}
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Steal
+//----------------------------------------------------------------------------
+std::shared_ptr<DelegateLib::DelegateMsg> ThreadPool::Steal(size_t index)
+{
+	if (m_stealable.load() == 0)
+		return nullptr;
+
+	for (size_t i = 1; i < m_workers.size(); i++)
+	{
+		Worker& victim = *m_workers[(index + i) % m_workers.size()];
+
+		// Skip a busy victim rather than wait on its lock
+		unique_lock<mutex> lk(victim.lock, try_to_lock);
+		if (!lk.owns_lock() || victim.deque.empty())
+			continue;
+
+		auto msg = std::move(victim.deque.back());
+		victim.deque.pop_back();
+		m_stealable--;
+		m_stealCnt++;
+		return msg;
+	}
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Process
+//----------------------------------------------------------------------------
+void ThreadPool::Process(size_t index)
+{
+	t_currentPool = this;
+	t_currentIndex = index;
+	SetCurrent(this);
+
+	Worker& worker = *m_workers[index];
+	while (1)
+	{
+		auto msg = Pop(index);
+		if (!msg)
+			msg = Steal(index);
+
+		if (msg)
+		{
+			m_queueSize--;
+
+			// Invoke the delegate destination target function
+			bool success = InvokeDelegate(msg);
+			ASSERT_TRUE(success);
+			continue;
+		}
+
+		// Sleep until a message is queued to this worker or is available to steal.
+		// The idle count increment below and the stealable count increment within
+		// Dispatch() are ordered so a wakeup is never lost.
+		unique_lock<mutex> lk(worker.lock);
+		if (m_exit && worker.deque.empty() && worker.ordered.empty())
+			break;
+		worker.sleeping = true;
+		m_idleCnt++;
+		worker.cv.wait(lk, [&]() {
+			return !worker.deque.empty() || !worker.ordered.empty() ||
+				m_stealable.load() > 0 || m_exit.load();
+		});
+		m_idleCnt--;
+		worker.sleeping = false;
+	}
+
+	SetCurrent(nullptr);
+	t_currentPool = nullptr;
+}
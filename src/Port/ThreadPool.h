@@ -0,0 +1,135 @@
+#ifndef _THREAD_POOL_H
+#define _THREAD_POOL_H
+
+/// @file
+/// @brief A `DelegateThread` backed by a pool of worker threads with work stealing.
+///
+/// @details Each worker owns a deque of messages. `DispatchDelegate()` distributes
+/// messages round-robin across the workers, or onto the calling worker's own deque
+/// when dispatched from within the pool. A worker invokes the messages in its own
+/// deque oldest first and, once empty, steals the newest message from another worker.
+/// An asynchronous delegate targeted at the pool therefore runs on whichever worker
+/// is free. Messages dispatched to the pool are not ordered and may be invoked
+/// concurrently, so only target stateless or thread-safe functions.
+///
+/// Target `GetOrdered()` instead to keep the messages from each producer thread in
+/// order. All messages from one producer thread are queued to the same worker and
+/// are never stolen, so they are invoked one at a time in dispatch order. Different
+/// producers still run concurrently on different workers.
+///
+/// Unlike `WorkerThread`, the pool does not service `Timer` instances.
+
+#include "DelegateOpt.h"
+#include "DelegateThread.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ThreadPool : public DelegateLib::DelegateThread
+{
+public:
+	/// Constructor
+	/// @param[in] poolName - the pool name.
+	/// @param[in] numThreads - the number of worker threads. Defaults to the number
+	/// of hardware threads.
+	ThreadPool(const std::string& poolName, size_t numThreads = std::thread::hardware_concurrency());
+
+	/// Destructor
+	~ThreadPool();
+
+	/// Called once to create the worker threads
+	/// @return TRUE if threads are created. FALSE otherise.
+	bool CreateThread();
+
+	/// Called once a program exit to exit the worker threads. Messages queued
+	/// before the call are invoked first. Messages dispatched during the call are 
+	/// discarded.
+	void ExitThread();
+
+	/// Get pool name
+	virtual std::string GetThreadName() { return POOL_NAME; }
+
+	/// Get the number of worker threads
+	size_t GetThreadCount() const { return m_workers.size(); }
+
+	/// Get the number of messages queued across all workers
+	size_t GetQueueSize() { return m_queueSize.load(); }
+
+	/// Get the number of messages a worker stole from another worker
+	size_t GetStealCount() { return m_stealCnt.load(); }
+
+	/// Get a `DelegateThread` that dispatches onto this pool while keeping the
+	/// messages from each producer thread in order.
+	/// @return The per-producer ordered dispatcher.
+	DelegateLib::DelegateThread& GetOrdered() { return m_ordered; }
+
+	virtual void DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg);
+
+private:
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// Per-worker queues and sleep state. Protected by `lock`.
+	struct Worker
+	{
+		std::mutex lock;
+		std::condition_variable cv;
+
+		/// Messages any worker may invoke
+		std::deque<std::shared_ptr<DelegateLib::DelegateMsg>> deque;
+
+		/// Per-producer ordered messages only this worker may invoke
+		std::deque<std::shared_ptr<DelegateLib::DelegateMsg>> ordered;
+
+		/// Alternate between the two queues so neither starves
+		bool preferOrdered = false;
+		bool sleeping = false;
+		std::unique_ptr<std::thread> thread;
+	};
+
+	/// Dispatches onto the pool keeping each producer's messages in order
+	class OrderedDispatch : public DelegateLib::DelegateThread
+	{
+	public:
+		OrderedDispatch(ThreadPool& pool) : m_pool(pool) {}
+		virtual void DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg) {
+			m_pool.Dispatch(std::move(msg), true);
+		}
+	private:
+		ThreadPool& m_pool;
+	};
+
+	/// Entry point for each worker thread
+	void Process(size_t index);
+
+	/// Select a worker and add a message to its queue
+	void Dispatch(std::shared_ptr<DelegateLib::DelegateMsg> msg, bool ordered);
+
+	/// Remove the next message from the worker's own queues
+	std::shared_ptr<DelegateLib::DelegateMsg> Pop(size_t index);
+
+	/// Remove the newest stealable message from another worker
+	std::shared_ptr<DelegateLib::DelegateMsg> Steal(size_t index);
+
+	/// Wake one sleeping worker to steal a message
+	void WakeIdle();
+
+	std::vector<std::unique_ptr<Worker>> m_workers;
+	std::atomic<size_t> m_next;
+	std::atomic<size_t> m_queueSize;
+	std::atomic<size_t> m_stealable;
+	std::atomic<size_t> m_idleCnt;
+	std::atomic<size_t> m_stealCnt;
+	std::atomic<bool> m_exit;
+	bool m_created;
+	OrderedDispatch m_ordered;
+
+	const std::string POOL_NAME;
+};
+
+#endif
@@ -1,58 +1,102 @@
 #include "Timer.h"
 #include "Fault.h"
+#include "WorkerThreadStd.h"
 #include <chrono>
+#include <stdexcept>
+#include <cmath>
 
 using namespace std;
 
-std::mutex Timer::m_lock;
-bool Timer::m_timerStopped = false;
-xlist<Timer*> Timer::m_timers;
+//------------------------------------------------------------------------------
+// Constructor
+//------------------------------------------------------------------------------
+Timer::Timer() : m_service(nullptr)
+{
+	m_enabled = false;
+}
 
 //------------------------------------------------------------------------------
-// TimerDisabled
+// Destructor
 //------------------------------------------------------------------------------
-static bool TimerDisabled (Timer* value)
+Timer::~Timer()
 {
-	return !(value->Enabled());
+	std::unique_lock<std::recursive_mutex> lk;
+	TimerService* service = LockService(lk);
+	if (service)
+		service->Remove(this);
 }
 
 //------------------------------------------------------------------------------
-// Constructor
+// LockService
 //------------------------------------------------------------------------------
-Timer::Timer() 
+TimerService* Timer::LockService(std::unique_lock<std::recursive_mutex>& lk)
 {
-	const std::lock_guard<std::mutex> lock(m_lock);
-	m_enabled = false;
+	while (true)
+	{
+		TimerService* service = m_service.load();
+		if (!service)
+			return nullptr;
+
+		lk = std::unique_lock<std::recursive_mutex>(service->m_lock);
+
+		// Registered service is only changed while holding the service lock
+		if (m_service.load() == service)
+			return service;
+		lk.unlock();
+	}
 }
 
 //------------------------------------------------------------------------------
-// Destructor
+// Start
 //------------------------------------------------------------------------------
-Timer::~Timer()
+void Timer::Start(std::chrono::microseconds timeout)
 {
-	const std::lock_guard<std::mutex> lock(m_lock);
-	m_timers.remove(this);
+	WorkerThread* thread = WorkerThread::GetCurrentWorkerThread();
+	if (!thread)
+		throw std::invalid_argument("Timer not started on a WorkerThread");
+
+	Start(timeout, *thread);
 }
 
 //------------------------------------------------------------------------------
 // Start
 //------------------------------------------------------------------------------
-void Timer::Start(std::chrono::milliseconds timeout)
+void Timer::Start(std::chrono::microseconds timeout, WorkerThread& thread)
 {
-	if (timeout <= std::chrono::milliseconds(0))
+	Start(timeout, thread.m_timerService);
+}
+
+//------------------------------------------------------------------------------
+// Start
+//------------------------------------------------------------------------------
+void Timer::Start(std::chrono::microseconds timeout, TimerService& service)
+{
+	if (timeout <= std::chrono::microseconds(0))
 		throw std::invalid_argument("Timeout cannot be 0");
 
-	const std::lock_guard<std::mutex> lock(m_lock);
+	{
+		// Remove from a different servicing thread, if any
+		std::unique_lock<std::recursive_mutex> lk;
+		TimerService* current = LockService(lk);
+		if (current && current != &service)
+			current->Remove(this);
+	}
+
+	{
+		const std::lock_guard<std::recursive_mutex> lock(service.m_lock);
 
-	m_timeout = timeout;
-	m_expireTime = GetTime();
-	m_enabled = true;
+		if (m_service.load() == &service)
+			service.Remove(this);
 
-	// Remove the existing entry, if any, to prevent duplicates in the list
-	m_timers.remove(this);
+		m_timeout = timeout;
+		m_expireTime = GetTime();
+		m_enabled = true;
+		service.Add(this);
+	}
 
-	// Add this timer to the list for servicing
-	m_timers.push_back(this);
+	// Wake the servicing thread to recompute the next expiration
+	if (service.m_wake)
+		service.m_wake();
 }
 
 //------------------------------------------------------------------------------
@@ -60,34 +104,88 @@ void Timer::Start(std::chrono::milliseconds timeout)
 //------------------------------------------------------------------------------
 void Timer::Stop()
 {
-	const std::lock_guard<std::mutex> lock(m_lock);
+	std::unique_lock<std::recursive_mutex> lk;
+	TimerService* service = LockService(lk);
+	if (service)
+		service->Remove(this);
+}
+
+//------------------------------------------------------------------------------
+// SetMeasure
+//------------------------------------------------------------------------------
+void Timer::SetMeasure(bool enable)
+{
+	std::unique_lock<std::recursive_mutex> lk;
+	LockService(lk);
 
-	m_enabled = false;
-	m_timerStopped = true;
+	if (enable)
+	{
+		m_stats = TimerStats();
+		m_lateSumSq = 0;
+	}
+	m_measure = enable;
+}
+
+//------------------------------------------------------------------------------
+// GetStats
+//------------------------------------------------------------------------------
+TimerStats Timer::GetStats()
+{
+	std::unique_lock<std::recursive_mutex> lk;
+	LockService(lk);
+	return m_stats;
 }
 
 //------------------------------------------------------------------------------
-// CheckExpired
+// Measure
 //------------------------------------------------------------------------------
-void Timer::CheckExpired()
+void Timer::Measure(std::chrono::microseconds scheduled, std::chrono::microseconds actual, bool overrun)
 {
-	if (!m_enabled)
-		return;
+	auto late = Difference(scheduled, actual);
+
+	m_stats.count++;
+	if (overrun)
+		m_stats.overruns++;
+	m_stats.lastScheduled = scheduled;
+	m_stats.lastActual = actual;
+	if (late < m_stats.minLate)
+		m_stats.minLate = late;
+	if (late > m_stats.maxLate)
+		m_stats.maxLate = late;
 
-	// Has the timer expired?
-    if (Difference(m_expireTime, GetTime()) < m_timeout)
-        return;
+	// Running mean and variance of the lateness
+	double value = static_cast<double>(late.count());
+	double delta = value - m_stats.meanLate;
+	m_stats.meanLate += delta / static_cast<double>(m_stats.count);
+	m_lateSumSq += delta * (value - m_stats.meanLate);
+	m_stats.jitter = std::sqrt(m_lateSumSq / static_cast<double>(m_stats.count));
+}
+
+//------------------------------------------------------------------------------
+// Expire
+//------------------------------------------------------------------------------
+void Timer::Expire()
+{
+	auto now = GetTime();
 
     // Increment the timer to the next expiration
 	m_expireTime += m_timeout;
+	auto scheduled = m_expireTime;
 
 	// Is the timer already expired after we incremented above?
-    if (Difference(m_expireTime, GetTime()) > m_timeout)
+	bool overrun = Difference(m_expireTime, now) > m_timeout;
+    if (overrun)
 	{
 		// The timer has fallen behind so set time expiration further forward.
-		m_expireTime = GetTime();
+		m_expireTime = now;
 	}
 
+	if (m_measure)
+		Measure(scheduled, now, overrun);
+
+	// Schedule the next expiration before the callback may stop the timer
+	m_service.load()->Add(this);
+
 	// Call the client's expired callback function
 	if (Expired)
 		Expired();
@@ -96,38 +194,91 @@ void Timer::CheckExpired()
 //------------------------------------------------------------------------------
 // Difference
 //------------------------------------------------------------------------------
-std::chrono::milliseconds Timer::Difference(std::chrono::milliseconds time1, std::chrono::milliseconds time2)
+std::chrono::microseconds Timer::Difference(std::chrono::microseconds time1, std::chrono::microseconds time2)
 {
 	return (time2 - time1);
 }
 
+std::chrono::microseconds Timer::GetTime()
+{
+	auto duration = std::chrono::steady_clock::now().time_since_epoch();
+	auto micros = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+	return micros;
+}
+
 //------------------------------------------------------------------------------
-// ProcessTimers
+// TimerService
 //------------------------------------------------------------------------------
-void Timer::ProcessTimers()
+TimerService::TimerService(std::function<void(void)> wake) :
+	m_wheel(ToTick(Timer::GetTime())), m_timerCnt(0), m_wake(wake)
 {
-	const std::lock_guard<std::mutex> lock(m_lock);
+}
 
-	// Remove disabled timer from the list if stopped
-	if (m_timerStopped)
-	{
-		m_timers.remove_if(TimerDisabled);
-		m_timerStopped = false;
-	}
+//------------------------------------------------------------------------------
+// ~TimerService
+//------------------------------------------------------------------------------
+TimerService::~TimerService()
+{
+	const std::lock_guard<std::recursive_mutex> lock(m_lock);
+	while (TimerWheelNode* node = m_expired.PopFront())
+		Remove(static_cast<Timer*>(node));
+	m_wheel.Advance(UINT64_MAX, m_expired);
+	while (TimerWheelNode* node = m_expired.PopFront())
+		Remove(static_cast<Timer*>(node));
+}
+
+//------------------------------------------------------------------------------
+// ToTick
+//------------------------------------------------------------------------------
+uint64_t TimerService::ToTick(std::chrono::microseconds time)
+{
+	return time.count() < 0 ? 0 : static_cast<uint64_t>(time.count());
+}
 
-	// Iterate through each timer and check for expirations
-	TimersIterator it;
-	for (it = m_timers.begin() ; it != m_timers.end(); it++ )
+//------------------------------------------------------------------------------
+// Add
+//------------------------------------------------------------------------------
+void TimerService::Add(Timer* timer)
+{
+	if (timer->m_service.load() != this)
 	{
-		if ((*it) != NULL)
-			(*it)->CheckExpired();
+		timer->m_service = this;
+		m_timerCnt++;
 	}
+	m_wheel.Insert(timer, ToTick(timer->m_expireTime + timer->m_timeout));
 }
 
-std::chrono::milliseconds Timer::GetTime()
+//------------------------------------------------------------------------------
+// Remove
+//------------------------------------------------------------------------------
+void TimerService::Remove(Timer* timer)
 {
-	auto duration = std::chrono::system_clock::now().time_since_epoch();
-	auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
-	return millis;
+	if (timer->IsLinked())
+		m_wheel.Remove(timer);
+	timer->m_enabled = false;
+	timer->m_service = nullptr;
+	m_timerCnt--;
 }
 
+//------------------------------------------------------------------------------
+// ProcessTimers
+//------------------------------------------------------------------------------
+std::chrono::microseconds TimerService::ProcessTimers()
+{
+	if (m_timerCnt == 0)
+		return std::chrono::microseconds::max();
+
+	const std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	// Collect the expired timers
+	m_wheel.Advance(ToTick(Timer::GetTime()), m_expired);
+
+	// Callback each expired timer. A callback may start, stop or delete any timer.
+	while (TimerWheelNode* node = m_expired.PopFront())
+		static_cast<Timer*>(node)->Expire();
+
+	uint64_t next = m_wheel.NextTick();
+	if (next == UINT64_MAX)
+		return std::chrono::microseconds::max();
+	return std::chrono::microseconds(next);
+}
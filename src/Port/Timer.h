@@ -2,14 +2,53 @@
 #define _TIMER_H
 
 #include "DelegateLib.h"
+#include "TimerWheel.h"
 #include <mutex>
-#include <list>
+#include <atomic>
+#include <chrono>
+#include <functional>
 
 using namespace DelegateLib;
 
-/// @brief A timer class provides periodic timer callbacks on the client's 
+class WorkerThread;
+class TimerService;
+
+/// @brief Timer expiration measurement results. Lateness is the actual expiration
+/// time minus the scheduled expiration time.
+struct TimerStats
+{
+	/// Number of measured expirations
+	uint64_t count = 0;
+
+	/// Number of expirations that fell behind more than one period. The timer
+	/// schedule is restarted from the actual expiration time.
+	uint64_t overruns = 0;
+
+	/// Scheduled and actual time of the most recent expiration
+	std::chrono::microseconds lastScheduled = std::chrono::microseconds(0);
+	std::chrono::microseconds lastActual = std::chrono::microseconds(0);
+
+	/// Minimum, maximum and mean lateness
+	std::chrono::microseconds minLate = std::chrono::microseconds::max();
+	std::chrono::microseconds maxLate = std::chrono::microseconds(0);
+	double meanLate = 0;
+
+	/// Standard deviation of the lateness (jitter) in microseconds
+	double jitter = 0;
+};
+
+/// @brief A timer class provides periodic timer callbacks on the client's
 /// thread of control. Timer is thread safe.
-class Timer 
+///
+/// @details Each timer is serviced by one `WorkerThread`. The `Expired` callback
+/// is invoked on that thread. The worker thread waits for messages with a timeout
+/// equal to the next expiration of the timers it services, so an idle thread is
+/// not woken unless a timer is due. Starting and stopping a timer is O(1).
+///
+/// Time is measured with `std::chrono::steady_clock` in microseconds, so wall clock
+/// adjustments do not affect expirations and sub-millisecond periods are supported.
+/// Call `SetMeasure()` to record the actual versus scheduled expiration times.
+class Timer : private TimerWheelNode
 {
 public:
 	/// Client's register with Expired to get timer callbacks
@@ -21,9 +60,21 @@ public:
 	/// Destructor
 	~Timer(void);
 
+	/// Starts a timer for callbacks on the specified timeout interval. The timer
+	/// is serviced by the calling `WorkerThread`.
+	/// @param[in]	timeout - the timeout in microseconds.
+	/// @throws std::invalid_argument If not called on a `WorkerThread`.
+	void Start(std::chrono::microseconds timeout);
+
 	/// Starts a timer for callbacks on the specified timeout interval.
-	/// @param[in]	timeout - the timeout in milliseconds.
-	void Start(std::chrono::milliseconds timeout);
+	/// @param[in]	timeout - the timeout in microseconds.
+	/// @param[in]	thread - the worker thread that services the timer.
+	void Start(std::chrono::microseconds timeout, WorkerThread& thread);
+
+	/// Starts a timer for callbacks on the specified timeout interval.
+	/// @param[in]	timeout - the timeout in microseconds.
+	/// @param[in]	service - the timer service that services the timer.
+	void Start(std::chrono::microseconds timeout, TimerService& service);
 
 	/// Stops a timer.
 	void Stop();
@@ -32,39 +83,110 @@ public:
 	/// @return		TRUE if the timer is enabled, FALSE otherwise.
 	bool Enabled() { return m_enabled; }
 
-	/// Get the current time in ticks. 
-	/// @return The current time in ticks. 
-    static std::chrono::milliseconds GetTime();
+	/// Enable or disable the expiration measurement mode. Enabling clears the
+	/// previous results.
+	/// @param[in] enable - `true` to record each expiration.
+	void SetMeasure(bool enable);
+
+	/// Get the expiration measurement results.
+	/// @return The results recorded since measurement was enabled.
+	TimerStats GetStats();
+
+	/// Get the current monotonic time.
+	/// @return The current time in microseconds.
+    static std::chrono::microseconds GetTime();
 
 	/// Computes the time difference in ticks between two tick values taking into
 	/// account rollover.
 	/// @param[in] 	time1 - time stamp 1 in ticks.
 	/// @param[in] 	time2 - time stamp 2 in ticks.
 	/// @return		The time difference in ticks.
-	static std::chrono::milliseconds Difference(std::chrono::milliseconds time1, std::chrono::milliseconds time2);
-
-	/// Called on a periodic basic to service all timer instances. 
-	static void ProcessTimers();
+	static std::chrono::microseconds Difference(std::chrono::microseconds time1, std::chrono::microseconds time2);
 
 private:
+	friend class TimerService;
+
 	// Prevent inadvertent copying of this object
 	Timer(const Timer&);
 	Timer& operator=(const Timer&);
 
-	/// Called to check for expired timers and callback registered clients.
-	void CheckExpired();
+	/// Called when the timer expires to schedule the next expiration and callback
+	/// registered clients.
+	void Expire();
+
+	/// Lock the timer service this timer is registered with, if any.
+	/// @param[out] lk - the lock to acquire.
+	/// @return The locked timer service, or `nullptr` if not registered.
+	TimerService* LockService(std::unique_lock<std::recursive_mutex>& lk);
 
-	/// List of all system timers to be serviced.
-	static xlist<Timer*> m_timers;
-	typedef xlist<Timer*>::iterator TimersIterator;
+	/// The timer service this timer is registered with. Changed while holding
+	/// the timer service lock.
+	std::atomic<TimerService*> m_service;
 
-	/// A lock to make this class thread safe.
-	static std::mutex m_lock;
+	/// Record an expiration. Called with the service lock held.
+	void Measure(std::chrono::microseconds scheduled, std::chrono::microseconds actual, bool overrun);
 
-	std::chrono::milliseconds m_timeout = std::chrono::milliseconds(0);		
-	std::chrono::milliseconds m_expireTime = std::chrono::milliseconds(0);
+	std::chrono::microseconds m_timeout = std::chrono::microseconds(0);
+	std::chrono::microseconds m_expireTime = std::chrono::microseconds(0);
 	bool m_enabled = false;
-	static bool m_timerStopped;
+
+	/// Expiration measurement mode
+	bool m_measure = false;
+	TimerStats m_stats;
+	double m_lateSumSq = 0;
+};
+
+/// @brief Services the timers owned by one `WorkerThread`.
+///
+/// @details The owner thread calls `ProcessTimers()` to invoke expired timers and
+/// then waits for messages until the returned expiration time. `wake` is called
+/// when a timer is started so the owner thread recomputes the expiration time.
+/// Timers are scheduled within a `TimerWheel`, so processing timers only visits
+/// the timers that expire.
+class TimerService
+{
+public:
+	/// Constructor
+	/// @param[in] wake - called when a timer is started.
+	TimerService(std::function<void(void)> wake);
+
+	/// Destructor. Stops all remaining timers.
+	~TimerService();
+
+	/// Called by the owner thread to service all expired timers.
+	/// @return The next `Timer::GetTime()` time to call `ProcessTimers()`, or
+	/// `std::chrono::microseconds::max()` if no timer is enabled.
+	std::chrono::microseconds ProcessTimers();
+
+private:
+	friend class Timer;
+
+	TimerService(const TimerService&) = delete;
+	TimerService& operator=(const TimerService&) = delete;
+
+	/// Schedule a timer expiration. Called with m_lock held.
+	void Add(Timer* timer);
+
+	/// Remove a timer. Called with m_lock held.
+	void Remove(Timer* timer);
+
+	/// Convert a time to a timer wheel tick.
+	static uint64_t ToTick(std::chrono::microseconds time);
+
+	/// The enabled timers not yet expired.
+	TimerWheel m_wheel;
+
+	/// Expired timers waiting for callback.
+	TimerWheelList m_expired;
+
+	/// A lock to make this class thread safe. Recursive so an `Expired`
+	/// callback can start or stop a timer.
+	std::recursive_mutex m_lock;
+
+	/// Number of registered timers.
+	std::atomic<size_t> m_timerCnt;
+
+	std::function<void(void)> m_wake;
 };
 
 #endif
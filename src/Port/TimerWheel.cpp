@@ -0,0 +1,239 @@
+#include "TimerWheel.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//------------------------------------------------------------------------------
+// HighestBit
+//------------------------------------------------------------------------------
+static int HighestBit(uint64_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return static_cast<int>(index);
+#else
+	return 63 - __builtin_clzll(value);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// LowestBit
+//------------------------------------------------------------------------------
+static int LowestBit(uint64_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return static_cast<int>(index);
+#else
+	return __builtin_ctzll(value);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// RotateLeft
+//------------------------------------------------------------------------------
+static uint64_t RotateLeft(uint64_t value, int shift)
+{
+	shift &= 63;
+	return shift == 0 ? value : (value << shift) | (value >> (64 - shift));
+}
+
+//------------------------------------------------------------------------------
+// PushBack
+//------------------------------------------------------------------------------
+void TimerWheelList::PushBack(TimerWheelNode* node)
+{
+	node->m_next = &m_head;
+	node->m_prev = m_head.m_prev;
+	m_head.m_prev->m_next = node;
+	m_head.m_prev = node;
+}
+
+//------------------------------------------------------------------------------
+// PopFront
+//------------------------------------------------------------------------------
+TimerWheelNode* TimerWheelList::PopFront()
+{
+	if (Empty())
+		return nullptr;
+
+	TimerWheelNode* node = m_head.m_next;
+	Unlink(node);
+	return node;
+}
+
+//------------------------------------------------------------------------------
+// Splice
+//------------------------------------------------------------------------------
+void TimerWheelList::Splice(TimerWheelList& other)
+{
+	if (other.Empty())
+		return;
+
+	TimerWheelNode* first = other.m_head.m_next;
+	TimerWheelNode* last = other.m_head.m_prev;
+
+	first->m_prev = m_head.m_prev;
+	m_head.m_prev->m_next = first;
+	last->m_next = &m_head;
+	m_head.m_prev = last;
+
+	other.m_head.m_next = other.m_head.m_prev = &other.m_head;
+}
+
+//------------------------------------------------------------------------------
+// Clear
+//------------------------------------------------------------------------------
+void TimerWheelList::Clear()
+{
+	while (PopFront()) {}
+}
+
+//------------------------------------------------------------------------------
+// Unlink
+//------------------------------------------------------------------------------
+void TimerWheelList::Unlink(TimerWheelNode* node)
+{
+	node->m_prev->m_next = node->m_next;
+	node->m_next->m_prev = node->m_prev;
+	node->m_next = node->m_prev = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Insert
+//------------------------------------------------------------------------------
+void TimerWheel::Insert(TimerWheelNode* node, uint64_t expire)
+{
+	node->m_expire = expire;
+
+	// Limit the wheel position to the top level. The node cascades through
+	// the top level again if not expired.
+	uint64_t tick = expire;
+	uint64_t limit = m_now | MAX_TICKS;
+	if (tick > limit)
+		tick = limit;
+
+	if (tick <= m_now)
+	{
+		node->m_level = READY;
+		m_ready.PushBack(node);
+		return;
+	}
+
+	int level = HighestBit(tick ^ m_now) / SLOT_BITS;
+	int slot = static_cast<int>((tick >> (level * SLOT_BITS)) & (SLOTS - 1));
+
+	node->m_level = static_cast<uint8_t>(level);
+	node->m_slot = static_cast<uint8_t>(slot);
+	m_slots[level][slot].PushBack(node);
+	m_occupied[level] |= uint64_t(1) << slot;
+}
+
+//------------------------------------------------------------------------------
+// Remove
+//------------------------------------------------------------------------------
+void TimerWheel::Remove(TimerWheelNode* node)
+{
+	TimerWheelList::Unlink(node);
+	if (node->m_level != READY && m_slots[node->m_level][node->m_slot].Empty())
+		m_occupied[node->m_level] &= ~(uint64_t(1) << node->m_slot);
+}
+
+//------------------------------------------------------------------------------
+// Advance
+//------------------------------------------------------------------------------
+void TimerWheel::Advance(uint64_t now, TimerWheelList& expired)
+{
+	TimerWheelList pending;
+	pending.Splice(m_ready);
+
+	if (now > m_now)
+	{
+		// Collect the nodes in each slot passed between the current and new tick
+		for (int level = 0; level < LEVELS; level++)
+		{
+			const int shift = level * SLOT_BITS;
+			uint64_t elapsed = (now >> shift) - (m_now >> shift);
+			if (elapsed == 0)
+				break;
+
+			uint64_t passed = ~uint64_t(0);
+			if (elapsed < SLOTS)
+			{
+				int slot = static_cast<int>((m_now >> shift) & (SLOTS - 1));
+				passed = RotateLeft((uint64_t(1) << elapsed) - 1, slot + 1);
+			}
+
+			uint64_t occupied = m_occupied[level] & passed;
+			m_occupied[level] &= ~passed;
+			while (occupied)
+			{
+				pending.Splice(m_slots[level][LowestBit(occupied)]);
+				occupied &= occupied - 1;
+			}
+		}
+		m_now = now;
+	}
+
+	// Expire or cascade the collected nodes
+	while (TimerWheelNode* node = pending.PopFront())
+	{
+		if (node->m_expire <= m_now)
+		{
+			node->m_level = READY;
+			expired.PushBack(node);
+		}
+		else
+			Insert(node, node->m_expire);
+	}
+}
+
+//------------------------------------------------------------------------------
+// NextTick
+//------------------------------------------------------------------------------
+uint64_t TimerWheel::NextTick() const
+{
+	if (!m_ready.Empty())
+		return m_now;
+
+	uint64_t next = UINT64_MAX;
+	for (int level = 0; level < LEVELS; level++)
+	{
+		if (m_occupied[level] == 0)
+			continue;
+
+		const int shift = level * SLOT_BITS;
+		int current = static_cast<int>((m_now >> shift) & (SLOTS - 1));
+
+		// Occupied slots follow the current slot within the level span
+		uint64_t span = (m_now >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+		uint64_t later = m_occupied[level] & ~((uint64_t(2) << current) - 1);
+		if (later == 0)
+		{
+			later = m_occupied[level];
+			span += uint64_t(1) << (shift + SLOT_BITS);
+		}
+
+		uint64_t tick = span + (uint64_t(LowestBit(later)) << shift);
+		if (tick < next)
+			next = tick;
+	}
+	return next;
+}
+
+//------------------------------------------------------------------------------
+// Clear
+//------------------------------------------------------------------------------
+void TimerWheel::Clear()
+{
+	m_ready.Clear();
+	for (int level = 0; level < LEVELS; level++)
+	{
+		for (int slot = 0; slot < SLOTS; slot++)
+			m_slots[level][slot].Clear();
+		m_occupied[level] = 0;
+	}
+}
@@ -0,0 +1,156 @@
+#ifndef _TIMER_WHEEL_H
+#define _TIMER_WHEEL_H
+
+/// @file
+/// @brief Hierarchical timing wheel used to schedule `Timer` expirations.
+///
+/// @details The wheel has `LEVELS` levels of `SLOTS` slots. Level 0 slots are one
+/// tick wide and each higher level slot spans all the slots of the level below.
+/// A node is placed on the level of the most significant bit that differs between
+/// its expiration tick and the current wheel tick. When the wheel advances, nodes
+/// in each passed slot either expire or cascade down to a lower level.
+///
+/// Insert and remove are O(1). Advancing the wheel visits only non-empty passed
+/// slots using a per level occupancy bitmap, so the work per advance is
+/// proportional to the number of expiring or cascading nodes.
+///
+/// The wheel is not thread safe. See `TimerService` for usage.
+
+#include <cstdint>
+
+/// @brief A node linked into a `TimerWheelList`. Inherit from this class to
+/// schedule an object within a `TimerWheel`.
+class TimerWheelNode
+{
+public:
+	TimerWheelNode() = default;
+
+	/// Check if the node is linked into a list.
+	/// @return `true` if linked.
+	bool IsLinked() const { return m_next != nullptr; }
+
+private:
+	friend class TimerWheelList;
+	friend class TimerWheel;
+
+	TimerWheelNode(const TimerWheelNode&) = delete;
+	TimerWheelNode& operator=(const TimerWheelNode&) = delete;
+
+	TimerWheelNode* m_next = nullptr;
+	TimerWheelNode* m_prev = nullptr;
+
+	/// The expiration tick.
+	uint64_t m_expire = 0;
+
+	/// The wheel level and slot the node is linked into.
+	uint8_t m_level = 0;
+	uint8_t m_slot = 0;
+};
+
+/// @brief Intrusive circular doubly linked list of `TimerWheelNode` instances.
+class TimerWheelList
+{
+public:
+	TimerWheelList() { m_head.m_next = m_head.m_prev = &m_head; }
+	~TimerWheelList() { Clear(); }
+
+	/// Check if the list is empty.
+	bool Empty() const { return m_head.m_next == &m_head; }
+
+	/// Add a node to the end of the list. The node must not be linked.
+	void PushBack(TimerWheelNode* node);
+
+	/// Remove the first node from the list.
+	/// @return The first node, or `nullptr` if the list is empty.
+	TimerWheelNode* PopFront();
+
+	/// Move all nodes from another list to the end of this list.
+	void Splice(TimerWheelList& other);
+
+	/// Unlink all nodes.
+	void Clear();
+
+	/// Unlink a node from the list it is linked into.
+	static void Unlink(TimerWheelNode* node);
+
+private:
+	TimerWheelList(const TimerWheelList&) = delete;
+	TimerWheelList& operator=(const TimerWheelList&) = delete;
+
+	TimerWheelNode m_head;
+};
+
+/// @brief Hierarchical timing wheel.
+class TimerWheel
+{
+public:
+	/// Number of slot index bits per level
+	static const int SLOT_BITS = 6;
+
+	/// Number of slots per level
+	static const int SLOTS = 1 << SLOT_BITS;
+
+	/// Number of levels
+	static const int LEVELS = 6;
+
+	/// Nodes expiring beyond this many ticks are cascaded through the top level
+	static const uint64_t MAX_TICKS = (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+
+	/// Constructor
+	/// @param[in] now - the current tick.
+	TimerWheel(uint64_t now = 0) : m_now(now) {}
+
+	/// Destructor. Unlinks all nodes.
+	~TimerWheel() { Clear(); }
+
+	/// Insert a node. The node must not be linked.
+	/// @param[in] node - the node to insert.
+	/// @param[in] expire - the node expiration tick. A tick not later than
+	/// the current tick expires on the next `Advance()`.
+	void Insert(TimerWheelNode* node, uint64_t expire);
+
+	/// Remove a node inserted with `Insert()`.
+	/// @param[in] node - the node to remove.
+	void Remove(TimerWheelNode* node);
+
+	/// Advance the wheel to a new tick and collect the expired nodes.
+	/// @param[in] now - the new current tick. Ticks earlier than the current
+	/// tick do not move the wheel backwards.
+	/// @param[out] expired - the expired nodes are added to this list.
+	void Advance(uint64_t now, TimerWheelList& expired);
+
+	/// Get the earliest tick to call `Advance()`. A node may cascade to a lower
+	/// level at this tick instead of expiring.
+	/// @return The next tick, or `UINT64_MAX` if the wheel is empty.
+	uint64_t NextTick() const;
+
+	/// Get the expiration tick of a node.
+	static uint64_t GetExpire(const TimerWheelNode* node) { return node->m_expire; }
+
+	/// Get the current tick.
+	uint64_t GetNow() const { return m_now; }
+
+	/// Unlink all nodes.
+	void Clear();
+
+private:
+	TimerWheel(const TimerWheel&) = delete;
+	TimerWheel& operator=(const TimerWheel&) = delete;
+
+	/// Level value of a node linked into m_ready
+	static const uint8_t READY = 0xFF;
+
+	/// The current tick. All nodes expiring at or before this tick have expired.
+	uint64_t m_now;
+
+	/// Nodes inserted with an expiration not later than the current tick
+	TimerWheelList m_ready;
+
+	/// The slots of each level
+	TimerWheelList m_slots[LEVELS][SLOTS];
+
+	/// Bit set for each non-empty slot of each level
+	uint64_t m_occupied[LEVELS] = {};
+};
+
+#endif
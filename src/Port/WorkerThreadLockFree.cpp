@@ -0,0 +1,169 @@
+#include "DelegateOpt.h"
+#include "WorkerThreadLockFree.h"
+
+#ifdef WIN32
+#include <Windows.h>
+#endif
+
+using namespace std;
+using namespace DelegateLib;
+
+//----------------------------------------------------------------------------
+// WorkerThreadLockFree
+//----------------------------------------------------------------------------
+WorkerThreadLockFree::WorkerThreadLockFree(const std::string& threadName) : 
+	m_thread(nullptr), m_queueSize(0), m_exitMsg(std::make_shared<DelegateMsg>(nullptr)), 
+	m_sleeping(false), m_wakeSeq(0), THREAD_NAME(threadName)
+{
+}
+
+//----------------------------------------------------------------------------
+// ~WorkerThreadLockFree
+//----------------------------------------------------------------------------
+WorkerThreadLockFree::~WorkerThreadLockFree()
+{
+	ExitThread();
+}
+
+//----------------------------------------------------------------------------
+// CreateThread
+//----------------------------------------------------------------------------
+bool WorkerThreadLockFree::CreateThread()
+{
+	if (!m_thread)
+	{
+		m_thread = std::unique_ptr<std::thread>(new thread(&WorkerThreadLockFree::Process, this));
+
+#ifdef WIN32
+		// Set the thread name so it shows in the Visual Studio Debug Location toolbar
+		std::wstring wstr(THREAD_NAME.begin(), THREAD_NAME.end());
+		SetThreadDescription(m_thread->native_handle(), wstr.c_str());
+#endif
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+// GetThreadId
+//----------------------------------------------------------------------------
+std::thread::id WorkerThreadLockFree::GetThreadId()
+{
+	if (m_thread == nullptr)
+		throw std::invalid_argument("Thread pointer is null");
+
+	return m_thread->get_id();
+}
+
+//----------------------------------------------------------------------------
+// GetCurrentThreadId
+//----------------------------------------------------------------------------
+std::thread::id WorkerThreadLockFree::GetCurrentThreadId()
+{
+	return this_thread::get_id();
+}
+
+//----------------------------------------------------------------------------
+// ExitThread
+//----------------------------------------------------------------------------
+void WorkerThreadLockFree::ExitThread()
+{
+	if (!m_thread)
+		return;
+
+	// Put exit thread message into the queue. Messages queued before the exit
+	// message are invoked first.
+	Push(m_exitMsg);
+
+	m_thread->join();
+	m_thread = nullptr;
+}
+
+//----------------------------------------------------------------------------
+// DispatchDelegate
+//----------------------------------------------------------------------------
+void WorkerThreadLockFree::DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg)
+{
+	if (m_thread == nullptr)
+		throw std::invalid_argument("Thread pointer is null");
+
+	RecordDispatch(*msg);
+	Push(std::move(msg));
+}
+
+//----------------------------------------------------------------------------
+// Push
+//----------------------------------------------------------------------------
+void WorkerThreadLockFree::Push(std::shared_ptr<DelegateLib::DelegateMsg> msg)
+{
+	m_queueSize++;
+	m_queue.Push(std::move(msg));
+
+	// Only signal the worker thread if sleeping. The push above and the load below 
+	// pair with the store/load order in Sleep() so a wakeup is never lost.
+	if (m_sleeping.load())
+	{
+#if defined(__cpp_lib_atomic_wait)
+		m_wakeSeq++;
+		m_wakeSeq.notify_one();
+#else
+		{
+			lock_guard<mutex> lock(m_mutex);
+			m_wakeSeq++;
+		}
+		m_cv.notify_one();
+#endif
+	}
+}
+
+//----------------------------------------------------------------------------
+// Sleep
+//----------------------------------------------------------------------------
+void WorkerThreadLockFree::Sleep()
+{
+	unsigned wakeSeq = m_wakeSeq.load();
+	m_sleeping.store(true);
+
+	// Check again after announcing sleep; a producer may have pushed in between
+	if (m_queue.Empty())
+	{
+#if defined(__cpp_lib_atomic_wait)
+		m_wakeSeq.wait(wakeSeq);
+#else
+		unique_lock<mutex> lk(m_mutex);
+		m_cv.wait(lk, [&]() { return m_wakeSeq.load() != wakeSeq; });
+#endif
+	}
+	m_sleeping.store(false);
+}
+
+//----------------------------------------------------------------------------
+// Process
+//----------------------------------------------------------------------------
+void WorkerThreadLockFree::Process()
+{
+	SetCurrent(this);
+
+	while (1)
+	{
+		auto msg = m_queue.Pop();
+		if (!msg)
+		{
+			if (m_queue.Empty())
+				Sleep();
+			else
+				std::this_thread::yield();	// A producer is mid-push
+			continue;
+		}
+		m_queueSize--;
+
+		if (msg == m_exitMsg)
+		{
+			SetCurrent(nullptr);
+			return;
+		}
+
+		// Invoke the delegate destination target function
+		bool success = InvokeDelegate(msg);
+		ASSERT_TRUE(success);
+	}
+}
@@ -0,0 +1,89 @@
+#ifndef _THREAD_LOCK_FREE_H
+#define _THREAD_LOCK_FREE_H
+
+/// @file
+/// @brief A `DelegateThread` backed by an intrusive lock-free multiple producer,
+/// single consumer message queue.
+///
+/// @details `DispatchDelegate()` pushes a message with a single atomic exchange and
+/// does not take a lock. The worker thread only sleeps when the queue is empty.
+/// Producers signal the worker only while it is sleeping. With C++20 the worker
+/// sleeps using `std::atomic::wait()`, which is a futex on Linux. Otherwise a
+/// mutex and condition variable are used on the sleep path only.
+///
+/// Unlike `WorkerThread`, this thread does not service `Timer` instances.
+
+#include "DelegateOpt.h"
+#include "DelegateThread.h"
+#include "LockFreeQueue.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+
+class WorkerThreadLockFree : public DelegateLib::DelegateThread
+{
+public:
+	/// Constructor
+	WorkerThreadLockFree(const std::string& threadName);
+
+	/// Destructor
+	~WorkerThreadLockFree();
+
+	/// Called once to create the worker thread
+	/// @return TRUE if thread is created. FALSE otherise. 
+	bool CreateThread();
+
+	/// Called once a program exit to exit the worker thread
+	void ExitThread();
+
+	/// Get the ID of this thread instance
+	std::thread::id GetThreadId();
+
+	/// Get the ID of the currently executing thread
+	static std::thread::id GetCurrentThreadId();
+
+	/// Get thread name
+	virtual std::string GetThreadName() { return THREAD_NAME; }
+
+	/// Get size of thread message queue.
+	size_t GetQueueSize() { return m_queueSize.load(); }
+
+	virtual void DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg);
+
+private:
+	WorkerThreadLockFree(const WorkerThreadLockFree&) = delete;
+	WorkerThreadLockFree& operator=(const WorkerThreadLockFree&) = delete;
+
+	/// Entry point for the thread
+	void Process();
+
+	/// Add a message to the queue and wake the worker thread if sleeping
+	void Push(std::shared_ptr<DelegateLib::DelegateMsg> msg);
+
+	/// Sleep until a producer signals the queue is not empty
+	void Sleep();
+
+	std::unique_ptr<std::thread> m_thread;
+	LockFreeQueue m_queue;
+	std::atomic<size_t> m_queueSize;
+
+	/// Message that signals the worker thread to exit
+	const std::shared_ptr<DelegateLib::DelegateMsg> m_exitMsg;
+
+	/// True while the worker thread is sleeping or about to sleep
+	std::atomic<bool> m_sleeping;
+
+	/// Incremented by a producer to wake the worker thread
+	std::atomic<unsigned> m_wakeSeq;
+
+#if !defined(__cpp_lib_atomic_wait)
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+#endif
+
+	const std::string THREAD_NAME;
+};
+
+#endif 
@@ -1,7 +1,8 @@
 #include "DelegateOpt.h"
 #include "WorkerThreadStd.h"
-#include "ThreadMsg.h"
 #include "Timer.h"
+#include "Delegate.h"
+#include <stdexcept>
 
 #ifdef WIN32
 #include <Windows.h>
@@ -11,13 +12,18 @@ using namespace std;
 using namespace DelegateLib;
 
 #define MSG_DISPATCH_DELEGATE	1
-#define MSG_EXIT_THREAD			2
-#define MSG_TIMER				3
+
+// The worker thread instance of the currently executing thread, if any
+static thread_local WorkerThread* t_currentWorkerThread = nullptr;
 
 //----------------------------------------------------------------------------
 // WorkerThread
 //----------------------------------------------------------------------------
-WorkerThread::WorkerThread(const std::string& threadName) : m_thread(nullptr), m_timerExit(false), THREAD_NAME(threadName)
+WorkerThread::WorkerThread(const std::string& threadName) : m_thread(nullptr), m_queueSize(0), 
+	m_batchLevel(0), m_preempt(false), m_batchSize(0), m_maxBatchSize(DEFAULT_MAX_BATCH_SIZE), 
+	m_dequeueLockCnt(0), m_maxQueueSize(0), m_fullPolicy(FullPolicy::BLOCK), m_blockedCnt(0), 
+	m_exit(false), m_highWaterMark(0), m_dropCnt(0), m_timerService([this]() { WakeTimers(); }), 
+	m_timerUpdate(false), THREAD_NAME(threadName)
 {
 }
 
@@ -36,6 +42,10 @@ bool WorkerThread::CreateThread()
 {
 	if (!m_thread)
 	{
+		{
+			lock_guard<mutex> lock(m_mutex);
+			m_exit = false;
+		}
 		m_thread = std::unique_ptr<std::thread>(new thread(&WorkerThread::Process, this));
 
 #ifdef WIN32
@@ -73,13 +83,56 @@ std::thread::id WorkerThread::GetCurrentThreadId()
 	return this_thread::get_id();
 }
 
+//----------------------------------------------------------------------------
+// GetCurrentWorkerThread
+//----------------------------------------------------------------------------
+WorkerThread* WorkerThread::GetCurrentWorkerThread()
+{
+	return t_currentWorkerThread;
+}
+
 //----------------------------------------------------------------------------
 // GetQueueSize
 //----------------------------------------------------------------------------
 size_t WorkerThread::GetQueueSize()
 {
 	lock_guard<mutex> lock(m_mutex);
-	return m_queue.size();
+	return m_queueSize + m_batchSize;
+}
+
+//----------------------------------------------------------------------------
+// SetMaxBatchSize
+//----------------------------------------------------------------------------
+void WorkerThread::SetMaxBatchSize(size_t maxBatchSize)
+{
+	if (maxBatchSize == 0)
+		throw std::invalid_argument("Max batch size must be greater than 0");
+
+	m_maxBatchSize = maxBatchSize;
+}
+
+//----------------------------------------------------------------------------
+// SetMaxQueueSize
+//----------------------------------------------------------------------------
+void WorkerThread::SetMaxQueueSize(size_t maxQueueSize, FullPolicy policy)
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_maxQueueSize = maxQueueSize;
+		m_fullPolicy = policy;
+	}
+
+	// Blocked producers recheck the new capacity and policy
+	m_cvSpace.notify_all();
+}
+
+//----------------------------------------------------------------------------
+// GetMaxQueueSize
+//----------------------------------------------------------------------------
+size_t WorkerThread::GetMaxQueueSize()
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_maxQueueSize;
 }
 
 //----------------------------------------------------------------------------
@@ -90,16 +143,18 @@ void WorkerThread::ExitThread()
 	if (!m_thread)
 		return;
 
-	// Create a new ThreadMsg
-	std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(MSG_EXIT_THREAD, 0));
-
-	// Put exit thread message into the queue
+	// Stop accepting messages. The worker thread invokes the messages already queued, 
+	// regardless of priority, and then exits. Since the queue only shrinks from here, 
+	// steady traffic from other threads cannot postpone the exit.
 	{
 		lock_guard<mutex> lock(m_mutex);
-		m_queue.push(threadMsg);
+		m_exit = true;
 		m_cv.notify_one();
 	}
 
+	// Release producers blocked on a full queue
+	m_cvSpace.notify_all();
+
     m_thread->join();
     m_thread = nullptr;
 }
@@ -112,31 +167,211 @@ void WorkerThread::DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> ms
 	if (m_thread == nullptr)
 		throw std::invalid_argument("Thread pointer is null");
 
-	// Create a new ThreadMsg
-    std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(MSG_DISPATCH_DELEGATE, msg));
+	size_t level = static_cast<size_t>(msg->GetPriority());
+	if (level >= DELEGATE_PRIORITY_LEVELS)
+		throw std::invalid_argument("Invalid message priority");
+
+	RecordDispatch(*msg);
 
-	// Add dispatch delegate msg to queue and notify worker thread
+	// Add dispatch delegate msg to its priority queue and notify worker thread
 	std::unique_lock<std::mutex> lk(m_mutex);
-	m_queue.push(threadMsg);
+	if (!m_exit && m_maxQueueSize > 0 && m_queueSize >= m_maxQueueSize && !MakeSpace(lk, msg, level))
+		return;
+
+	// The thread is exiting and only invokes messages queued before ExitThread()
+	if (m_exit)
+	{
+		msg->TryDiscard();
+		RecordDiscard(*msg);
+		m_dropCnt++;
+		return;
+	}
+
+	m_queue[level].emplace_back(MSG_DISPATCH_DELEGATE, std::move(msg));
+	m_queueSize++;
+	if (m_queueSize > m_highWaterMark)
+		m_highWaterMark = m_queueSize;
+
+	// Preempt a batch of lower priority messages being invoked
+	if (m_batchSize > 0 && level > m_batchLevel)
+		m_preempt = true;
 	m_cv.notify_one();
 }
 
 //----------------------------------------------------------------------------
-// TimerThread
+// MakeSpace
 //----------------------------------------------------------------------------
-void WorkerThread::TimerThread()
+bool WorkerThread::MakeSpace(std::unique_lock<std::mutex>& lk, std::shared_ptr<DelegateLib::DelegateMsg>& msg, size_t level)
 {
-    while (!m_timerExit)
-    {
-        std::this_thread::sleep_for(100ms);
+	switch (m_fullPolicy)
+	{
+		case FullPolicy::BLOCK:
+		{
+			// The worker thread cannot wait for itself to remove messages
+			if (t_currentWorkerThread != this)
+			{
+				auto space = [this]() {
+					return m_maxQueueSize == 0 || m_queueSize < m_maxQueueSize || 
+						m_fullPolicy != FullPolicy::BLOCK || m_exit;
+				};
+
+				// Do not block past the source thread deadline, if any
+				m_blockedCnt++;
+				auto deadline = msg->GetDeadline();
+				bool ready = true;
+				if (deadline == std::chrono::steady_clock::time_point::max())
+					m_cvSpace.wait(lk, space);
+				else
+					ready = m_cvSpace.wait_until(lk, deadline, space);
+				m_blockedCnt--;
+
+				// Deadline expired while blocked. Drop the dispatched message.
+				if (!ready)
+					break;
+
+				// Apply a policy changed while blocked
+				if (m_maxQueueSize > 0 && m_queueSize >= m_maxQueueSize && 
+					m_fullPolicy != FullPolicy::BLOCK && !m_exit)
+					return MakeSpace(lk, msg, level);
+			}
+			return true;
+		}
+
+		case FullPolicy::DROP_OLDEST:
+		{
+			for (size_t i = 0; i <= level; i++)
+			{
+				auto& queue = m_queue[i];
+				for (auto it = queue.begin(); it != queue.end(); ++it)
+				{
+					auto data = it->GetData();
+					if (data && data->TryDiscard())
+					{
+						RecordDiscard(*data);
+						queue.erase(it);
+						m_queueSize--;
+						m_dropCnt++;
+						return true;
+					}
+				}
+			}
+			break;
+		}
 
-        std::shared_ptr<ThreadMsg> threadMsg (new ThreadMsg(MSG_TIMER, 0));
+		case FullPolicy::COALESCE:
+		{
+			auto delegate = msg->GetDelegate();
+			auto& queue = m_queue[level];
+			for (auto it = queue.rbegin(); delegate && it != queue.rend(); ++it)
+			{
+				auto data = it->GetData();
+				if (data && data->GetDelegate() && data->GetDelegate()->Equal(*delegate) && 
+					data->TryDiscard())
+				{
+					// Latest arguments win at the queued message position
+					RecordDiscard(*data);
+					*it = ThreadMsg(MSG_DISPATCH_DELEGATE, std::move(msg));
+					m_dropCnt++;
+					return false;
+				}
+			}
+			break;
+		}
 
-        // Add timer msg to queue and notify worker thread
-        std::unique_lock<std::mutex> lk(m_mutex);
-        m_queue.push(threadMsg);
-        m_cv.notify_one();
-    }
+		case FullPolicy::FAIL:
+		{
+			if (msg->TryDiscard())
+			{
+				RecordDiscard(*msg);
+				m_dropCnt++;
+				throw std::overflow_error("Thread message queue is full");
+			}
+			return true;
+		}
+
+		default:
+			break;
+	}
+
+	// Drop the dispatched message
+	if (msg->TryDiscard())
+	{
+		RecordDiscard(*msg);
+		m_dropCnt++;
+		return false;
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+// GetLevel
+//----------------------------------------------------------------------------
+size_t WorkerThread::GetLevel(ThreadMsg& msg)
+{
+	auto data = msg.GetData();
+	return data ? static_cast<size_t>(data->GetPriority()) : 0;
+}
+
+//----------------------------------------------------------------------------
+// PopBatch
+//----------------------------------------------------------------------------
+void WorkerThread::PopBatch(std::deque<ThreadMsg>& batch)
+{
+	size_t maxBatchSize = m_maxBatchSize;
+	for (size_t level = DELEGATE_PRIORITY_LEVELS; level-- > 0 && batch.size() < maxBatchSize; )
+	{
+		auto& queue = m_queue[level];
+		if (queue.empty())
+			continue;
+
+		if (batch.empty() && queue.size() <= maxBatchSize)
+		{
+			std::swap(batch, queue);
+		}
+		else
+		{
+			while (!queue.empty() && batch.size() < maxBatchSize)
+			{
+				batch.push_back(std::move(queue.front()));
+				queue.pop_front();
+			}
+		}
+		m_batchLevel = level;
+	}
+	m_queueSize -= batch.size();
+	m_batchSize = batch.size();
+	m_preempt = false;
+
+	// Wake producers blocked on a full queue
+	if (m_blockedCnt > 0)
+		m_cvSpace.notify_all();
+}
+
+//----------------------------------------------------------------------------
+// PushFrontBatch
+//----------------------------------------------------------------------------
+void WorkerThread::PushFrontBatch(std::deque<ThreadMsg>& batch)
+{
+	// Each batch message is older than any queued message of the same priority
+	m_queueSize += batch.size();
+	while (!batch.empty())
+	{
+		ThreadMsg& msg = batch.back();
+		m_queue[GetLevel(msg)].push_front(std::move(msg));
+		batch.pop_back();
+	}
+	m_batchSize = 0;
+}
+
+//----------------------------------------------------------------------------
+// WakeTimers
+//----------------------------------------------------------------------------
+void WorkerThread::WakeTimers()
+{
+	// Notify worker thread to recompute the next timer expiration
+	std::unique_lock<std::mutex> lk(m_mutex);
+	m_timerUpdate = true;
+	m_cv.notify_one();
 }
 
 //----------------------------------------------------------------------------
@@ -144,56 +379,82 @@ void WorkerThread::TimerThread()
 //----------------------------------------------------------------------------
 void WorkerThread::Process()
 {
-    m_timerExit = false;
-    std::thread timerThread(&WorkerThread::TimerThread, this);
+	t_currentWorkerThread = this;
+	SetCurrent(this);
 
+	std::deque<ThreadMsg> batch;
 	while (1)
 	{
-		std::shared_ptr<ThreadMsg> msg;
+		// Service expired timers and get the next timer expiration
+		auto expireTime = m_timerService.ProcessTimers();
+
 		{
-			// Wait for a message to be added to the queue
+			// Wait for a message to be added to the queue or the next timer expiration
 			std::unique_lock<std::mutex> lk(m_mutex);
-			while (m_queue.empty())
-				m_cv.wait(lk);
+			while (m_queueSize == 0 && !m_timerUpdate && !m_exit)
+			{
+				if (expireTime == std::chrono::microseconds::max())
+				{
+					m_cv.wait(lk);
+				}
+				else
+				{
+					auto deadline = std::chrono::steady_clock::time_point(
+						std::chrono::duration_cast<std::chrono::steady_clock::duration>(expireTime));
+					if (m_cv.wait_until(lk, deadline) == std::cv_status::timeout)
+						break;
+				}
+			}
+			m_timerUpdate = false;
+
+			// All messages queued before ExitThread() invoked?
+			if (m_queueSize == 0 && m_exit)
+				break;
 
-			if (m_queue.empty())
+			// Timer expired or started with no message queued
+			if (m_queueSize == 0)
 				continue;
 
-			msg = m_queue.front();
-			m_queue.pop();
+			// Remove a batch of messages under a single lock
+			PopBatch(batch);
+			m_dequeueLockCnt++;
 		}
 
-		switch (msg->GetId())
+		// Invoke the batch without locking
+		while (!batch.empty())
 		{
-			case MSG_DISPATCH_DELEGATE:
-			{
-				// Get pointer to DelegateMsg data from queue msg data
-				auto delegateMsg = msg->GetData();
-				ASSERT_TRUE(delegateMsg);
-
-				auto invoker = delegateMsg->GetDelegateInvoker();
-				ASSERT_TRUE(invoker);
+			ThreadMsg msg = std::move(batch.front());
+			batch.pop_front();
+			m_batchSize--;
 
-				// Invoke the delegate destination target function
-				bool success = invoker->Invoke(delegateMsg);
-				ASSERT_TRUE(success);
-				break;
-			}
-
-            case MSG_TIMER:
-				Timer::ProcessTimers();
-				break;
-
-			case MSG_EXIT_THREAD:
+			switch (msg.GetId())
 			{
-                m_timerExit = true;
-                timerThread.join();
-                return;
+				case MSG_DISPATCH_DELEGATE:
+				{
+					// Get pointer to DelegateMsg data from queue msg data
+					auto delegateMsg = msg.GetData();
+					ASSERT_TRUE(delegateMsg);
+
+					// Invoke the delegate destination target function
+					bool success = InvokeDelegate(delegateMsg);
+					ASSERT_TRUE(success);
+
+					// Higher priority message queued? Return the rest of the batch.
+					if (m_preempt.load(std::memory_order_relaxed) && !batch.empty())
+					{
+						std::unique_lock<std::mutex> lk(m_mutex);
+						PushFrontBatch(batch);
+					}
+					break;
+				}
+
+				default:
+					throw std::invalid_argument("Invalid message ID");
 			}
-
-			default:
-				throw std::invalid_argument("Invalid message ID");
 		}
 	}
+
+	t_currentWorkerThread = nullptr;
+	SetCurrent(nullptr);
 }
 
@@ -6,17 +6,42 @@
 
 #include "DelegateOpt.h"
 #include "DelegateThread.h"
+#include "ThreadMsg.h"
+#include "Timer.h"
 #include <thread>
-#include <queue>
+#include <deque>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
 
-class ThreadMsg;
-
 class WorkerThread : public DelegateLib::DelegateThread
 {
 public:
+	/// Default maximum number of messages removed from the queue under a single lock
+	static const size_t DEFAULT_MAX_BATCH_SIZE = 32;
+
+	/// Action taken when a message is dispatched to a full bounded queue. A message 
+	/// that refuses `DelegateMsg::TryDiscard()` is queued regardless of the policy. 
+	/// A dropped blocking `DelegateAsyncWait` call returns as if the timeout expired.
+	enum class FullPolicy
+	{
+		/// Block the producer until the queue has space. A message dispatched by the 
+		/// worker thread onto its own queue is queued without blocking. A message with 
+		/// a deadline, such as a `DelegateAsyncWait` call with a finite timeout, blocks 
+		/// until the deadline at most and is then dropped as if the timeout expired.
+		BLOCK,
+		/// Drop the dispatched message
+		DROP_NEWEST,
+		/// Drop the oldest queued message of equal or lower priority. Otherwise drop 
+		/// the dispatched message.
+		DROP_OLDEST,
+		/// Replace the newest queued message of equal priority bound to the same target
+		/// function, keeping its queue position. Otherwise drop the dispatched message.
+		COALESCE,
+		/// Throw `std::overflow_error` to the producer
+		FAIL
+	};
+
 	/// Constructor
 	WorkerThread(const std::string& threadName);
 
@@ -27,7 +52,9 @@ public:
 	/// @return TRUE if thread is created. FALSE otherise. 
 	bool CreateThread();
 
-	/// Called once a program exit to exit the worker thread
+	/// Called once a program exit to exit the worker thread. Messages queued before the 
+	/// call are invoked, regardless of priority, and then the thread exits. Messages 
+	/// dispatched after the call are dropped, so continuous traffic cannot delay the exit.
 	void ExitThread();
 
 	/// Get the ID of this thread instance
@@ -36,29 +63,107 @@ public:
 	/// Get the ID of the currently executing thread
 	static std::thread::id GetCurrentThreadId();
 
+	/// Get the worker thread instance of the currently executing thread
+	/// @return The current worker thread, or `nullptr` if not called on a worker thread.
+	static WorkerThread* GetCurrentWorkerThread();
+
 	/// Get thread name
-	std::string GetThreadName() { return THREAD_NAME; }
+	virtual std::string GetThreadName() { return THREAD_NAME; }
 
 	/// Get size of thread message queue.
 	size_t GetQueueSize();
 
+	/// Set the maximum number of messages the worker thread removes from the queue 
+	/// under a single lock and then invokes without locking again. A size of 1 
+	/// removes one message at a time. Timers are serviced between batches, so a smaller 
+	/// batch size services them sooner under a heavy load.
+	/// A message dispatched with a higher priority than a message within the current 
+	/// batch ends the batch early once the executing message returns.
+	/// @param[in] maxBatchSize - the maximum batch size. Must be greater than 0.
+	void SetMaxBatchSize(size_t maxBatchSize);
+
+	/// Get the number of times the worker thread locked the queue to remove messages.
+	size_t GetDequeueLockCount() { return m_dequeueLockCnt.load(); }
+
+	/// Bound the number of messages waiting in the queue.
+	/// @param[in] maxQueueSize - the queue capacity, or 0 for an unbounded queue.
+	/// @param[in] policy - the action taken when a message is dispatched to a full queue.
+	void SetMaxQueueSize(size_t maxQueueSize, FullPolicy policy = FullPolicy::BLOCK);
+
+	/// Get the queue capacity.
+	/// @return The capacity, or 0 if unbounded.
+	size_t GetMaxQueueSize();
+
+	/// Get the largest number of messages waiting in the queue since the thread was constructed.
+	size_t GetHighWaterMark() { return m_highWaterMark.load(); }
+
+	/// Get the number of messages dropped, replaced or refused by a full queue.
+	size_t GetDropCount() { return m_dropCnt.load(); }
+
+	/// Add a message to the queue. Messages are invoked highest `DelegatePriority` 
+	/// first, and in dispatch order within each priority. Enqueue and dequeue are 
+	/// constant time regardless of queue depth.
+	/// @param[in] msg - the message to invoke on this thread.
 	virtual void DispatchDelegate(std::shared_ptr<DelegateLib::DelegateMsg> msg);
 
 private:
+	friend class Timer;
+
 	WorkerThread(const WorkerThread&) = delete;
 	WorkerThread& operator=(const WorkerThread&) = delete;
 
 	/// Entry point for the thread
 	void Process();
 
-    /// Entry point for timer thread
-    void TimerThread();
+	/// Called when a timer is started to recompute the next timer expiration
+	void WakeTimers();
+
+	/// Remove a batch of messages from the queue, highest priority first. Called
+	/// with the queue locked.
+	void PopBatch(std::deque<ThreadMsg>& batch);
+
+	/// Return the messages remaining in a preempted batch to the front of the queue.
+	/// Called with the queue locked.
+	void PushFrontBatch(std::deque<ThreadMsg>& batch);
+
+	/// Get the queue index of a message
+	static size_t GetLevel(ThreadMsg& msg);
+
+	/// Apply the full policy to a message dispatched to a full queue. Called with the
+	/// queue locked.
+	/// @return `true` to queue the message. `false` if the message is dropped or has
+	/// replaced a queued message.
+	bool MakeSpace(std::unique_lock<std::mutex>& lk, std::shared_ptr<DelegateLib::DelegateMsg>& msg, size_t level);
 
 	std::unique_ptr<std::thread> m_thread;
-	std::queue<std::shared_ptr<ThreadMsg>> m_queue;
+
+	/// One FIFO queue per `DelegatePriority` level, indexed by priority
+	std::deque<ThreadMsg> m_queue[DelegateLib::DELEGATE_PRIORITY_LEVELS];
+	size_t m_queueSize;
+
+	/// The lowest priority level within the batch being invoked
+	size_t m_batchLevel;
+
+	/// Set when a message is queued with a higher priority than the batch
+	std::atomic<bool> m_preempt;
+
+	std::atomic<size_t> m_batchSize;
+	std::atomic<size_t> m_maxBatchSize;
+	std::atomic<size_t> m_dequeueLockCnt;
 	std::mutex m_mutex;
 	std::condition_variable m_cv;
-    std::atomic<bool> m_timerExit;
+
+	/// Bounded queue state. Protected by `m_mutex`.
+	size_t m_maxQueueSize;
+	FullPolicy m_fullPolicy;
+	size_t m_blockedCnt;
+	bool m_exit;
+	std::condition_variable m_cvSpace;
+	std::atomic<size_t> m_highWaterMark;
+	std::atomic<size_t> m_dropCnt;
+
+	TimerService m_timerService;
+	bool m_timerUpdate;
 	const std::string THREAD_NAME;
 };
 
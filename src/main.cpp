@@ -5,6 +5,7 @@
 #include "CountdownLatch.h"
 #include "ActiveObject.h"
 #include "AsyncFuture.h"
+#include "Coroutine.h"
 #include "Observer.h"
 #include <iostream>
 #include <chrono>
@@ -416,8 +417,8 @@ int main(void)
     // Create a timer that expires every 250mS and calls 
     // TimerExpiredCb on workerThread1 upon expiration
     Timer timer;
-    timer.Expired = MakeDelegate(&TimerExpiredCb, workerThread1);
-    timer.Start(std::chrono::milliseconds(250));
+    timer.Expired = MakeDelegate(&TimerExpiredCb);
+    timer.Start(std::chrono::milliseconds(250), workerThread1);
 
     // Run all unit tests
     DelegateUnitTests();
@@ -540,7 +541,6 @@ int main(void)
     int year = delegateI(msg);
     if (delegateI.IsSuccess())
     {
-        auto year2 = delegateI.GetRetVal();
         cout << msg.c_str() << " " << year << endl;
     }
 
@@ -723,6 +723,9 @@ int main(void)
     // Run countdown latch example
     CountdownLatchExample();
 
+    // Run C++20 coroutine example
+    CoroutineExample();
+
     // Run producer-consumer pattern example
     ProducerConsumerExample();
 
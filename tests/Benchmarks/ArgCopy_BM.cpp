@@ -0,0 +1,75 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <string>
+#include <tuple>
+
+// ArgCopy_BM.cpp
+// Cost of copying one asynchronous delegate argument into a message, by argument
+// type. Compares the heap copies created by make_tuple_heap() with the in place
+// arg_value<> copies stored within DelegateAsyncMsg.
+
+using namespace DelegateLib;
+
+static const int LOOPS = 1000000;
+
+static const void* volatile sink = nullptr;
+
+struct SmallData
+{
+    int values[4] = { 1, 2, 3, 4 };
+};
+
+struct LargeData
+{
+    int values[64] = {};
+    std::string name = "A name longer than the small string buffer";
+};
+
+// Publish the copy address so the copy is not optimized away
+template <class U>
+static void Consume(const U& value) { sink = &value; }
+
+template <class T>
+static void ArgCopy(const std::string& name, T arg)
+{
+    std::uint64_t allocs = GetAllocCount();
+    Stopwatch sw;
+    for (int i = 0; i < LOOPS; i++)
+    {
+        xlist<std::shared_ptr<heap_arg_deleter_base>> heapMem;
+        std::tuple<> start;
+        auto args = make_tuple_heap(heapMem, start, arg);
+        Consume(std::get<0>(args));
+    }
+    double ns = sw.ElapsedNs();
+    BenchmarkReport(name + " make_tuple_heap", ns / LOOPS, "ns/copy");
+    BenchmarkReport(name + " make_tuple_heap", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/copy");
+
+    allocs = GetAllocCount();
+    sw.Reset();
+    for (int i = 0; i < LOOPS; i++)
+    {
+        std::tuple<arg_value<T>> args(arg);
+        Consume(std::get<0>(args).get());
+    }
+    ns = sw.ElapsedNs();
+    BenchmarkReport(name + " arg_value", ns / LOOPS, "ns/copy");
+    BenchmarkReport(name + " arg_value", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/copy");
+}
+
+void ArgCopy_BM()
+{
+    SmallData small;
+    LargeData large;
+    SmallData* smallPtr = &small;
+    std::string str = "A string longer than the small string buffer";
+
+    ArgCopy<int>("int", 1);
+    ArgCopy<SmallData>("SmallData", small);
+    ArgCopy<const SmallData&>("const SmallData&", small);
+    ArgCopy<SmallData*>("SmallData*", &small);
+    ArgCopy<SmallData**>("SmallData**", &smallPtr);
+    ArgCopy<const LargeData&>("const LargeData&", large);
+    ArgCopy<LargeData*>("LargeData*", &large);
+    ArgCopy<const std::string&>("const std::string&", str);
+}
@@ -0,0 +1,106 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "ThreadMsg.h"
+#include "Benchmark.h"
+#include <string>
+
+// AsyncDispatch_BM.cpp
+// Heap allocations per asynchronous delegate call. 
+
+using namespace DelegateLib;
+
+static const int ITERATIONS = 100000;
+
+static WorkerThread workerThread("AsyncDispatch_BM");
+static std::atomic<int> callCnt(0);
+
+struct BenchmarkData
+{
+    int x = 0;
+    int y = 0;
+    std::string name;
+};
+
+static void FreeFuncInt(int) { callCnt++; }
+static void FreeFuncData(const BenchmarkData&) { callCnt++; }
+static void FreeFuncDataPtr(BenchmarkData*) { callCnt++; }
+
+class BenchmarkClass
+{
+public:
+    void MemberFuncInt(int) { callCnt++; }
+};
+
+/// @brief The original dispatch path message: a heap allocated delegate clone 
+/// owned by a `std::shared_ptr` and argument copies created by `make_tuple_heap()`.
+template <class...Args>
+class LegacyAsyncMsg : public DelegateMsg
+{
+public:
+    LegacyAsyncMsg(std::shared_ptr<IDelegateInvoker> invoker, Args... args) : DelegateMsg(invoker),
+        m_args(make_tuple_heap(m_heapMem, m_start, std::forward<Args>(args)...)) { }
+
+private:
+    xlist<std::shared_ptr<heap_arg_deleter_base>> m_heapMem;
+    std::tuple<> m_start;
+    std::tuple<Args...> m_args;
+};
+
+/// Replicate the allocations of the original dispatch path: the delegate clone, the 
+/// message with heap argument copies and a heap allocated `ThreadMsg` queue node. 
+template <class TDelegate, class... Args>
+static void LegacyDispatch(const TDelegate& delegate, Args... args)
+{
+    auto clone = std::shared_ptr<TDelegate>(delegate.Clone());
+    auto msg = std::make_shared<LegacyAsyncMsg<Args...>>(clone, std::forward<Args>(args)...);
+    std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(1, msg));
+}
+
+template <class TDelegate, class... Args>
+static void AllocsPerCall(const std::string& name, TDelegate& delegate, Args... args)
+{
+    callCnt = 0;
+    std::uint64_t allocs = GetAllocCount();
+    Stopwatch sw;
+    for (int i = 0; i < ITERATIONS; i++)
+        delegate(args...);
+    WaitForCount(callCnt, ITERATIONS);
+    double ns = sw.ElapsedNs();
+    allocs = GetAllocCount() - allocs;
+
+    BenchmarkReport(name + " allocs", static_cast<double>(allocs) / ITERATIONS, "allocs/call");
+    BenchmarkReport(name + " time", ns / ITERATIONS, "ns/call");
+
+    allocs = GetAllocCount();
+    for (int i = 0; i < ITERATIONS; i++)
+        LegacyDispatch(delegate, args...);
+    allocs = GetAllocCount() - allocs;
+    BenchmarkReport(name + " allocs (original)", static_cast<double>(allocs) / ITERATIONS, "allocs/call");
+}
+
+void AsyncDispatch_BM()
+{
+    workerThread.CreateThread();
+
+    BenchmarkClass benchmarkClass;
+    BenchmarkData data;
+    data.name = "AsyncDispatch_BM";
+
+    auto freeInt = MakeDelegate(&FreeFuncInt, workerThread);
+    AllocsPerCall("DelegateFreeAsync void(int)", freeInt, 1);
+
+    auto memberInt = MakeDelegate(&benchmarkClass, &BenchmarkClass::MemberFuncInt, workerThread);
+    AllocsPerCall("DelegateMemberAsync void(int)", memberInt, 1);
+
+    std::function<void(int)> func = [](int) { callCnt++; };
+    auto functionInt = MakeDelegate(func, workerThread);
+    AllocsPerCall("DelegateFunctionAsync void(int)", functionInt, 1);
+
+    auto freeData = MakeDelegate(&FreeFuncData, workerThread);
+    AllocsPerCall<decltype(freeData), const BenchmarkData&>("DelegateFreeAsync void(const Data&)", freeData, data);
+
+    auto freeDataPtr = MakeDelegate(&FreeFuncDataPtr, workerThread);
+    AllocsPerCall("DelegateFreeAsync void(Data*)", freeDataPtr, &data);
+
+    workerThread.ExitThread();
+}
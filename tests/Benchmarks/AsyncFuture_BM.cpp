@@ -0,0 +1,81 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <future>
+#include <string>
+#include <vector>
+
+// AsyncFuture_BM.cpp
+// Many asynchronous calls in flight with a result. AsyncInvokeFuture() completed 
+// by the destination thread is measured against wrapping a blocking AsyncWait 
+// delegate within std::async, which requires one thread per outstanding call.
+
+using namespace DelegateLib;
+
+static const int IN_FLIGHT = 200;
+static const int ROUNDS = 20;
+
+static WorkerThread workerThread("AsyncFuture_BM");
+
+static volatile int sink = 0;
+
+static int FreeFuncInt(int value) { return value + 1; }
+
+static void StdAsync()
+{
+    auto delegate = MakeDelegate(&FreeFuncInt, workerThread, WAIT_INFINITE);
+
+    Stopwatch sw;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        std::vector<std::future<int>> futures;
+        futures.reserve(IN_FLIGHT);
+        for (int i = 0; i < IN_FLIGHT; i++)
+            futures.push_back(std::async(std::launch::async, delegate, i));
+        for (auto& future : futures)
+            sink = future.get();
+    }
+    BenchmarkReport("std::async AsyncWait " + std::to_string(IN_FLIGHT) + " in flight", 
+        sw.ElapsedNs() / (ROUNDS * IN_FLIGHT), "ns/call");
+}
+
+static void Future()
+{
+    auto delegate = MakeDelegate(&FreeFuncInt, workerThread);
+
+    Stopwatch sw;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        std::vector<DelegateFuture<int>> futures;
+        futures.reserve(IN_FLIGHT);
+        for (int i = 0; i < IN_FLIGHT; i++)
+            futures.push_back(delegate.AsyncInvokeFuture(i));
+        for (auto& future : futures)
+            sink = *future.Get();
+    }
+    BenchmarkReport("AsyncInvokeFuture " + std::to_string(IN_FLIGHT) + " in flight", 
+        sw.ElapsedNs() / (ROUNDS * IN_FLIGHT), "ns/call");
+}
+
+static void FutureThen()
+{
+    auto delegate = MakeDelegate(&FreeFuncInt, workerThread);
+
+    std::atomic<int> completed(0);
+    Stopwatch sw;
+    for (int i = 0; i < ROUNDS * IN_FLIGHT; i++)
+        delegate.AsyncInvokeFuture(i).Then([&completed](int) { completed++; });
+    WaitForCount(completed, ROUNDS * IN_FLIGHT);
+    BenchmarkReport("AsyncInvokeFuture Then()", sw.ElapsedNs() / (ROUNDS * IN_FLIGHT), "ns/call");
+}
+
+void AsyncFuture_BM()
+{
+    workerThread.CreateThread();
+
+    StdAsync();
+    Future();
+    FutureThen();
+
+    workerThread.ExitThread();
+}
@@ -0,0 +1,201 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <algorithm>
+#include <any>
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// AsyncWait_BM.cpp
+// Blocking asynchronous call round trip latency. The Completion based path is 
+// measured against the original Semaphore and mutex completion protocol. The 
+// latency histogram compares SpinPolicy settings. The large return value round 
+// trip compares the typed message return slot against the original std::any copies.
+
+using namespace DelegateLib;
+
+static const int ITERATIONS = 20000;
+
+static WorkerThread workerThread("AsyncWait_BM");
+
+static volatile int sink = 0;
+
+static int FreeFuncInt(int value) { return value + 1; }
+
+struct LargeRet
+{
+    std::array<char, 256> data;
+};
+
+static LargeRet FreeFuncLarge(int value) 
+{ 
+    LargeRet ret;
+    ret.data.fill(static_cast<char>(value));
+    return ret;
+}
+
+namespace Legacy
+{
+    /// The original blocking call message: a `Semaphore` plus a second mutex 
+    /// protecting the invoker waiting flag.
+    class WaitMsg : public DelegateMsg
+    {
+    public:
+        WaitMsg(std::shared_ptr<IDelegateInvoker> invoker, int arg) : DelegateMsg(invoker), m_arg(arg) { }
+
+        int m_arg;
+        Semaphore m_sema;
+        std::mutex m_lock;
+        bool m_invokerWaiting = false;
+    };
+
+    /// The original destination thread invoke and source thread wait protocol.
+    class WaitInvoker : public IDelegateInvoker
+    {
+    public:
+        virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+            auto waitMsg = std::static_pointer_cast<WaitMsg>(msg);
+            const std::lock_guard<std::mutex> lock(waitMsg->m_lock);
+            if (waitMsg->m_invokerWaiting) {
+                m_retVal = FreeFuncInt(waitMsg->m_arg);
+                waitMsg->m_sema.Signal();
+            }
+            return true;
+        }
+
+        int operator()(int arg) {
+            auto invoker = std::make_shared<WaitInvoker>();
+            auto msg = std::make_shared<WaitMsg>(invoker, arg);
+            msg->m_invokerWaiting = true;
+            workerThread.DispatchDelegate(msg);
+            bool success = msg->m_sema.Wait(WAIT_INFINITE);
+            const std::lock_guard<std::mutex> lock(msg->m_lock);
+            msg->m_invokerWaiting = false;
+            return success ? invoker->m_retVal : 0;
+        }
+
+        int m_retVal = 0;
+    };
+
+    /// The original return value handling: the destination thread clone stores the 
+    /// return value within `std::any`, copied into the caller delegate `std::any` 
+    /// and copied again by `std::any_cast`. 
+    class AnyRetInvoker : public IDelegateInvoker
+    {
+    public:
+        virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+            auto waitMsg = std::static_pointer_cast<WaitMsg>(msg);
+            const std::lock_guard<std::mutex> lock(waitMsg->m_lock);
+            if (waitMsg->m_invokerWaiting) {
+                m_retVal = FreeFuncLarge(waitMsg->m_arg);
+                waitMsg->m_sema.Signal();
+            }
+            return true;
+        }
+
+        LargeRet operator()(int arg) {
+            auto invoker = std::make_shared<AnyRetInvoker>();
+            auto msg = std::make_shared<WaitMsg>(invoker, arg);
+            msg->m_invokerWaiting = true;
+            workerThread.DispatchDelegate(msg);
+            bool success = msg->m_sema.Wait(WAIT_INFINITE);
+            const std::lock_guard<std::mutex> lock(msg->m_lock);
+            msg->m_invokerWaiting = false;
+            if (success)
+                m_retVal = invoker->m_retVal;
+            return m_retVal.has_value() ? std::any_cast<LargeRet>(m_retVal) : LargeRet{};
+        }
+
+        std::any m_retVal;
+    };
+}
+
+template <class TDelegate>
+static void RoundTrip(const std::string& name, TDelegate& delegate)
+{
+    // Warm up the destination thread
+    for (int i = 0; i < 100; i++)
+        delegate(i);
+
+    Stopwatch sw;
+    for (int i = 0; i < ITERATIONS; i++)
+        sink = delegate(i);
+    BenchmarkReport(name + " round trip", sw.ElapsedNs() / ITERATIONS, "ns/call");
+}
+
+template <class TDelegate>
+static void LargeRoundTrip(const std::string& name, TDelegate& delegate)
+{
+    for (int i = 0; i < 100; i++)
+        delegate(i);
+
+    auto allocs = GetAllocCount();
+    Stopwatch sw;
+    for (int i = 0; i < ITERATIONS; i++)
+        sink = delegate(i).data[0];
+    BenchmarkReport(name + " round trip", sw.ElapsedNs() / ITERATIONS, "ns/call");
+    BenchmarkReport(name + " allocations", 
+        static_cast<double>(GetAllocCount() - allocs) / ITERATIONS, "allocs/call");
+}
+
+static void LatencyHistogram(const std::string& name, const SpinPolicy& spin)
+{
+    auto delegate = MakeDelegate(&FreeFuncInt, workerThread, WAIT_INFINITE);
+    delegate.SetSpinPolicy(spin);
+    for (int i = 0; i < 100; i++)
+        delegate(i);
+
+    std::vector<double> samples(ITERATIONS);
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        Stopwatch sw;
+        delegate(i);
+        samples[i] = sw.ElapsedNs() / 1000.0;
+    }
+    std::sort(samples.begin(), samples.end());
+
+    std::string prefix = name + " (spins=" + std::to_string(spin.spins) + 
+        " yields=" + std::to_string(spin.yields) + ")";
+    BenchmarkReport(prefix + " p50", samples[ITERATIONS / 2], "us");
+    BenchmarkReport(prefix + " p90", samples[ITERATIONS * 9 / 10], "us");
+    BenchmarkReport(prefix + " p99", samples[ITERATIONS * 99 / 100], "us");
+    BenchmarkReport(prefix + " max", samples.back(), "us");
+
+    // Power of two microsecond buckets
+    double upper = 1.0;
+    std::size_t begin = 0;
+    while (begin < samples.size())
+    {
+        auto end = std::upper_bound(samples.begin() + begin, samples.end(), upper) - samples.begin();
+        if (end > static_cast<std::ptrdiff_t>(begin))
+            BenchmarkReport(prefix + " <= " + std::to_string(static_cast<int>(upper)) + "us",
+                100.0 * (end - begin) / ITERATIONS, "%");
+        begin = static_cast<std::size_t>(end);
+        upper *= 2;
+    }
+}
+
+void AsyncWait_BM()
+{
+    workerThread.CreateThread();
+
+    Legacy::WaitInvoker legacy;
+    RoundTrip("Legacy AsyncWait int(int)", legacy);
+
+    auto freeWait = MakeDelegate(&FreeFuncInt, workerThread, WAIT_INFINITE);
+    RoundTrip("DelegateFreeAsyncWait int(int)", freeWait);
+
+    Legacy::AnyRetInvoker legacyLarge;
+    LargeRoundTrip("Legacy AsyncWait std::any LargeRet(int)", legacyLarge);
+
+    auto largeWait = MakeDelegate(&FreeFuncLarge, workerThread, WAIT_INFINITE);
+    LargeRoundTrip("DelegateFreeAsyncWait LargeRet(int)", largeWait);
+
+    LatencyHistogram("DelegateFreeAsyncWait latency", SpinPolicy{ 0, 0 });
+    LatencyHistogram("DelegateFreeAsyncWait latency", SpinPolicy{ 0, 16 });
+    LatencyHistogram("DelegateFreeAsyncWait latency", SpinPolicy{ 2000, 16 });
+
+    workerThread.ExitThread();
+}
@@ -0,0 +1,61 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// BatchDrain_BM.cpp
+// WorkerThread queue lock acquisitions per message and throughput for
+// different maximum batch sizes.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 200000;
+static const int PRODUCERS = 4;
+
+static std::atomic<int> recvCnt(0);
+
+static void RecvFunc(int) { recvCnt++; }
+
+static void BatchDrain(size_t maxBatchSize)
+{
+    WorkerThread workerThread("BatchDrain_BM");
+    workerThread.SetMaxBatchSize(maxBatchSize);
+    workerThread.CreateThread();
+
+    recvCnt = 0;
+    const int perProducer = MESSAGES / PRODUCERS;
+    auto delegate = MakeDelegate(&RecvFunc, workerThread);
+
+    Stopwatch sw;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        threads.emplace_back([&delegate, perProducer]() {
+            auto local = delegate;
+            for (int i = 0; i < perProducer; i++)
+                local(i);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    WaitForCount(recvCnt, perProducer * PRODUCERS);
+    double ns = sw.ElapsedNs();
+
+    const double messages = perProducer * PRODUCERS;
+    const std::string name = "WorkerThread max batch " + std::to_string(maxBatchSize);
+    BenchmarkReport(name + " consumer locks", workerThread.GetDequeueLockCount() / messages, "locks/msg");
+    BenchmarkReport(name + " total locks", (messages + workerThread.GetDequeueLockCount()) / messages, "locks/msg");
+    BenchmarkReport(name + " throughput", messages / (ns / 1e9), "msgs/sec");
+
+    workerThread.ExitThread();
+}
+
+void BatchDrain_BM()
+{
+    BatchDrain(1);
+    BatchDrain(8);
+    BatchDrain(WorkerThread::DEFAULT_MAX_BATCH_SIZE);
+    BatchDrain(256);
+}
@@ -0,0 +1,74 @@
+#include "Benchmark.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+// Benchmark.cpp
+// Global operator new replacement to count heap allocations.
+
+static std::atomic<std::uint64_t> allocCount(0);
+
+static void* CountedAlloc(std::size_t size)
+{
+    allocCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new(std::size_t size)
+{
+    void* p = CountedAlloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* p = CountedAlloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+//----------------------------------------------------------------------------
+// GetAllocCount
+//----------------------------------------------------------------------------
+std::uint64_t GetAllocCount()
+{
+    return allocCount.load();
+}
+
+//----------------------------------------------------------------------------
+// WaitForCount
+//----------------------------------------------------------------------------
+void WaitForCount(const std::atomic<int>& counter, int value)
+{
+    while (counter.load() < value)
+        std::this_thread::yield();
+}
+
+//----------------------------------------------------------------------------
+// BenchmarkReport
+//----------------------------------------------------------------------------
+void BenchmarkReport(const std::string& name, double value, const std::string& units)
+{
+    printf("%-56s %14.2f %s\n", name.c_str(), value, units.c_str());
+}
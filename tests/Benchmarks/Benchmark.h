@@ -0,0 +1,50 @@
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+/// @file
+/// @brief Delegate library benchmark helper functions. 
+/// 
+/// @details Global `operator new` is replaced within the benchmark executable to 
+/// count every heap allocation made by any thread. 
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/// Get the number of heap allocations made by all threads since program start.
+/// @return The total heap allocation count.
+std::uint64_t GetAllocCount();
+
+/// Wait until a counter incremented by another thread reaches a value.
+/// @param[in] counter - the counter to poll.
+/// @param[in] value - the value to wait for.
+void WaitForCount(const std::atomic<int>& counter, int value);
+
+/// Output a benchmark result line.
+/// @param[in] name - the benchmark name.
+/// @param[in] value - the measured value.
+/// @param[in] units - the measured value units.
+void BenchmarkReport(const std::string& name, double value, const std::string& units);
+
+/// @brief Simple stopwatch to time a benchmark loop.
+class Stopwatch
+{
+public:
+    Stopwatch() : m_start(std::chrono::steady_clock::now()) {}
+
+    /// Restart the stopwatch.
+    void Reset() { m_start = std::chrono::steady_clock::now(); }
+
+    /// Get the elapsed time since construction or `Reset()`.
+    /// @return The elapsed time in nanoseconds.
+    double ElapsedNs() const {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start).count());
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif
@@ -0,0 +1,59 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <chrono>
+#include <string>
+
+// BoundedQueue_BM.cpp
+// WorkerThread queue high-water mark, dropped messages and producer throughput
+// when a producer floods a slow consumer, with and without a bounded queue.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 100000;
+static const size_t CAPACITY = 1024;
+static const auto CONSUMER_WORK = std::chrono::microseconds(1);
+
+static std::atomic<int> recvCnt(0);
+
+static void SlowFunc(int)
+{
+    // Simulate a consumer slower than the producer
+    auto end = std::chrono::steady_clock::now() + CONSUMER_WORK;
+    while (std::chrono::steady_clock::now() < end) {}
+    recvCnt++;
+}
+
+static void BoundedQueue(const std::string& name, size_t capacity, WorkerThread::FullPolicy policy)
+{
+    WorkerThread workerThread("BoundedQueue_BM");
+    workerThread.SetMaxQueueSize(capacity, policy);
+    workerThread.CreateThread();
+
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&SlowFunc, workerThread);
+
+    Stopwatch sw;
+    for (int i = 0; i < MESSAGES; i++)
+        delegate(i);
+    double ns = sw.ElapsedNs();
+
+    // Wait for every queued message to be invoked
+    int expected = MESSAGES - static_cast<int>(workerThread.GetDropCount());
+    WaitForCount(recvCnt, expected);
+
+    BenchmarkReport(name + " high-water mark", static_cast<double>(workerThread.GetHighWaterMark()), "msgs");
+    BenchmarkReport(name + " dropped", static_cast<double>(workerThread.GetDropCount()), "msgs");
+    BenchmarkReport(name + " producer", MESSAGES / (ns / 1e9), "msgs/sec");
+
+    workerThread.ExitThread();
+}
+
+void BoundedQueue_BM()
+{
+    BoundedQueue("Unbounded queue", 0, WorkerThread::FullPolicy::BLOCK);
+    BoundedQueue("Bounded queue BLOCK", CAPACITY, WorkerThread::FullPolicy::BLOCK);
+    BoundedQueue("Bounded queue DROP_NEWEST", CAPACITY, WorkerThread::FullPolicy::DROP_NEWEST);
+    BoundedQueue("Bounded queue DROP_OLDEST", CAPACITY, WorkerThread::FullPolicy::DROP_OLDEST);
+    BoundedQueue("Bounded queue COALESCE", CAPACITY, WorkerThread::FullPolicy::COALESCE);
+}
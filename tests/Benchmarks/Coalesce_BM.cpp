@@ -0,0 +1,57 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <chrono>
+#include <string>
+
+// Coalesce_BM.cpp
+// A burst of state updates sent to a slow subscriber using a plain asynchronous
+// delegate versus a latest value wins coalescing delegate. Reports the handler
+// invocations, the queue high-water mark and the time until the subscriber
+// observes the latest value.
+
+using namespace DelegateLib;
+
+static const int UPDATES = 10000;
+static const auto HANDLER_WORK = std::chrono::microseconds(5);
+
+static std::atomic<int> handlerCnt(0);
+static std::atomic<int> latest(0);
+
+static void StateChanged(int state)
+{
+    // Simulate a subscriber that redraws on each state change
+    auto end = std::chrono::steady_clock::now() + HANDLER_WORK;
+    while (std::chrono::steady_clock::now() < end) {}
+    handlerCnt++;
+    latest = state;
+}
+
+static void Coalesce(const std::string& name, bool coalesce)
+{
+    WorkerThread workerThread("Coalesce_BM");
+    workerThread.CreateThread();
+
+    handlerCnt = 0;
+    latest = 0;
+    auto delegate = MakeDelegate(&StateChanged, workerThread);
+    delegate.SetCoalesce(coalesce);
+
+    Stopwatch sw;
+    for (int i = 1; i <= UPDATES; i++)
+        delegate(i);
+    WaitForCount(latest, UPDATES);
+    double ns = sw.ElapsedNs();
+
+    BenchmarkReport(name + " handler calls", handlerCnt.load(), "calls");
+    BenchmarkReport(name + " high-water mark", static_cast<double>(workerThread.GetHighWaterMark()), "msgs");
+    BenchmarkReport(name + " latest value", ns / 1000, "us");
+
+    workerThread.ExitThread();
+}
+
+void Coalesce_BM()
+{
+    Coalesce("State burst plain async", false);
+    Coalesce("State burst coalescing", true);
+}
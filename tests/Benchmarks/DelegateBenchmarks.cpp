@@ -0,0 +1,114 @@
+#include "DelegateOpt.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+// DelegateBenchmarks.cpp
+// Delegate library benchmarks entry point.
+//
+// Usage: DelegateBenchmarks [--benchmark_filter=<text>] [--benchmark_list_tests]
+// Runs each benchmark whose name contains the filter text, or all benchmarks if
+// no filter. Build once with and once without -DENABLE_ALLOCATOR=ON to compare
+// the fixed-block allocator against the heap.
+
+extern void SyncInvoke_BM();
+extern void DelegateValue_BM();
+extern void DelegateEqual_BM();
+extern void ArgCopy_BM();
+extern void AsyncDispatch_BM();
+extern void ProducerScaling_BM();
+extern void BatchDrain_BM();
+extern void Timer_BM();
+extern void MulticastSafe_BM();
+extern void MulticastFanOut_BM();
+extern void Unsubscribe_BM();
+extern void AsyncWait_BM();
+extern void AsyncFuture_BM();
+extern void PoolScaling_BM();
+extern void Strand_BM();
+extern void PriorityLatency_BM();
+extern void BoundedQueue_BM();
+extern void Coalesce_BM();
+extern void ThreadStats_BM();
+extern void Trace_BM();
+
+struct Benchmark
+{
+    const char* name;
+    void (*func)();
+};
+
+static const Benchmark benchmarks[] = {
+    { "SyncInvoke", SyncInvoke_BM },
+    { "DelegateValue", DelegateValue_BM },
+    { "DelegateEqual", DelegateEqual_BM },
+    { "ArgCopy", ArgCopy_BM },
+    { "AsyncDispatch", AsyncDispatch_BM },
+    { "ProducerScaling", ProducerScaling_BM },
+    { "BatchDrain", BatchDrain_BM },
+    { "Timer", Timer_BM },
+    { "MulticastSafe", MulticastSafe_BM },
+    { "MulticastFanOut", MulticastFanOut_BM },
+    { "Unsubscribe", Unsubscribe_BM },
+    { "AsyncWait", AsyncWait_BM },
+    { "AsyncFuture", AsyncFuture_BM },
+    { "PoolScaling", PoolScaling_BM },
+    { "Strand", Strand_BM },
+    { "PriorityLatency", PriorityLatency_BM },
+    { "BoundedQueue", BoundedQueue_BM },
+    { "Coalesce", Coalesce_BM },
+    { "ThreadStats", ThreadStats_BM },
+    { "Trace", Trace_BM },
+};
+
+static const char FILTER_ARG[] = "--benchmark_filter=";
+static const char LIST_ARG[] = "--benchmark_list_tests";
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    bool list = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], FILTER_ARG, sizeof(FILTER_ARG) - 1) == 0)
+            filter = argv[i] + sizeof(FILTER_ARG) - 1;
+        else if (strcmp(argv[i], LIST_ARG) == 0)
+            list = true;
+        else
+        {
+            printf("Usage: %s [%s<text>] [%s]\n", argv[0], FILTER_ARG, LIST_ARG);
+            return 1;
+        }
+    }
+
+    if (list)
+    {
+        for (auto& benchmark : benchmarks)
+            if (std::string(benchmark.name).find(filter) != std::string::npos)
+                printf("%s\n", benchmark.name);
+        return 0;
+    }
+
+    printf("Delegate library benchmarks\n");
+#ifdef USE_ALLOCATOR
+    printf("Allocator: fixed-block (ENABLE_ALLOCATOR=ON)\n");
+#else
+    printf("Allocator: heap (ENABLE_ALLOCATOR=OFF)\n");
+#endif
+#ifdef NDEBUG
+    printf("Build: optimized\n");
+#else
+    printf("Build: debug, results are not representative\n");
+#endif
+    printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    for (auto& benchmark : benchmarks)
+    {
+        if (std::string(benchmark.name).find(filter) == std::string::npos)
+            continue;
+        printf("\n[%s]\n", benchmark.name);
+        benchmark.func();
+    }
+    return 0;
+}
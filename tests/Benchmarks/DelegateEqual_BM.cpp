@@ -0,0 +1,83 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <string>
+#include <vector>
+
+// DelegateEqual_BM.cpp
+// Delegate equality cost used by container removal scans. The type identifier
+// compare is measured against the legacy dynamic_cast based compare.
+
+using namespace DelegateLib;
+
+static const int SUBSCRIBERS = 1024;
+static const int LOOPS = 1000;
+
+class Subscriber
+{
+public:
+    void Func(int value) { m_value += value; }
+    int m_value = 0;
+};
+
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+namespace Legacy
+{
+    // Legacy DelegateMember::Equal() using dynamic_cast
+    using Del = DelegateMember<Subscriber, void(int)>;
+    static bool Equal(const Del& lhs, const DelegateBase& rhs)
+    {
+        auto derivedRhs = dynamic_cast<const Del*>(&rhs);
+        return derivedRhs && lhs == *derivedRhs;
+    }
+}
+#endif
+
+static volatile int sink = 0;
+
+void DelegateEqual_BM()
+{
+    // Removal scan compares the delegate against every stored delegate
+    std::vector<Subscriber> objects(SUBSCRIBERS);
+    std::vector<DelegateMember<Subscriber, void(int)>> delegates;
+    for (auto& object : objects)
+        delegates.push_back(MakeDelegate(&object, &Subscriber::Func));
+    const DelegateBase& last = delegates.back();
+
+    Stopwatch sw;
+    for (int i = 0; i < LOOPS; i++)
+    {
+        for (auto& delegate : delegates)
+            sink = sink + delegate.Equal(last);
+    }
+    BenchmarkReport("DelegateMember Equal", sw.ElapsedNs() / (static_cast<double>(LOOPS) * SUBSCRIBERS), "ns");
+
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+    sw.Reset();
+    for (int i = 0; i < LOOPS; i++)
+    {
+        for (auto& delegate : delegates)
+            sink = sink + Legacy::Equal(delegate, last);
+    }
+    BenchmarkReport("DelegateMember Equal (dynamic_cast)", sw.ElapsedNs() / (static_cast<double>(LOOPS) * SUBSCRIBERS), "ns");
+#endif
+
+    // Compare against a different delegate type
+    DelegateFree<void(int)> other;
+    sw.Reset();
+    for (int i = 0; i < LOOPS; i++)
+    {
+        for (auto& delegate : delegates)
+            sink = sink + delegate.Equal(other);
+    }
+    BenchmarkReport("DelegateMember Equal other type", sw.ElapsedNs() / (static_cast<double>(LOOPS) * SUBSCRIBERS), "ns");
+
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+    sw.Reset();
+    for (int i = 0; i < LOOPS; i++)
+    {
+        for (auto& delegate : delegates)
+            sink = sink + Legacy::Equal(delegate, other);
+    }
+    BenchmarkReport("DelegateMember Equal other type (dynamic_cast)", sw.ElapsedNs() / (static_cast<double>(LOOPS) * SUBSCRIBERS), "ns");
+#endif
+}
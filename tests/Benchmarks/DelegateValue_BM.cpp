@@ -0,0 +1,85 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <string>
+
+// DelegateValue_BM.cpp
+// Copy and invoke cost of the inline storage DelegateValue compared to the heap
+// based DelegateFree, DelegateMember and DelegateFunction types.
+
+using namespace DelegateLib;
+
+static const int LOOPS = 1000000;
+
+static volatile int sink = 0;
+
+class Target
+{
+public:
+    void Func(int value) { m_value += value; }
+    int m_value = 0;
+};
+
+static void FreeTarget(int value) { sink = value; }
+
+template <class Del>
+static void Invoke(const std::string& name, Del delegate)
+{
+    std::uint64_t allocs = GetAllocCount();
+    Stopwatch sw;
+    for (int i = 0; i < LOOPS; i++)
+        delegate(i);
+    double ns = sw.ElapsedNs();
+    BenchmarkReport(name + " invoke", ns / LOOPS, "ns");
+    BenchmarkReport(name + " invoke", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/call");
+}
+
+template <class Del>
+static void Copy(const std::string& name, const Del& delegate)
+{
+    std::uint64_t allocs = GetAllocCount();
+    Stopwatch sw;
+    for (int i = 0; i < LOOPS; i++)
+    {
+        Del copy(delegate);
+        copy(i);
+    }
+    double ns = sw.ElapsedNs();
+    BenchmarkReport(name + " copy and invoke", ns / LOOPS, "ns");
+    BenchmarkReport(name + " copy and invoke", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/copy");
+}
+
+void DelegateValue_BM()
+{
+    Target target;
+    auto lambda = [&target](int value) { target.m_value -= value; };
+
+    Invoke("DelegateFree", MakeDelegate(&FreeTarget));
+    Invoke("DelegateValue free", DelegateValue<void(int)>(&FreeTarget));
+    Invoke("DelegateMember", MakeDelegate(&target, &Target::Func));
+    Invoke("DelegateValue member", DelegateValue<void(int)>(&target, &Target::Func));
+    Invoke("DelegateFunction", MakeDelegate(std::function<void(int)>(lambda)));
+    Invoke("DelegateValue lambda", DelegateValue<void(int)>(lambda));
+
+    Copy("DelegateFree", MakeDelegate(&FreeTarget));
+    Copy("DelegateValue free", DelegateValue<void(int)>(&FreeTarget));
+    Copy("DelegateMember", MakeDelegate(&target, &Target::Func));
+    Copy("DelegateValue member", DelegateValue<void(int)>(&target, &Target::Func));
+    Copy("DelegateFunction", MakeDelegate(std::function<void(int)>(lambda)));
+    Copy("DelegateValue lambda", DelegateValue<void(int)>(lambda));
+
+    // Construct from a raw object pointer without a shared_ptr control block
+    std::uint64_t allocs = GetAllocCount();
+    for (int i = 0; i < LOOPS; i++)
+    {
+        DelegateValue<void(int)> delegate(&target, &Target::Func);
+        delegate(i);
+    }
+    BenchmarkReport("DelegateValue member bind", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/bind");
+    allocs = GetAllocCount();
+    for (int i = 0; i < LOOPS; i++)
+    {
+        auto delegate = MakeDelegate(&target, &Target::Func);
+        delegate(i);
+    }
+    BenchmarkReport("DelegateMember bind", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/bind");
+}
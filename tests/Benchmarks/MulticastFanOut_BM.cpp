@@ -0,0 +1,71 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <string>
+#include <vector>
+
+// MulticastFanOut_BM.cpp
+// Synchronous broadcast cost of the list based MulticastDelegate compared to the
+// contiguous MulticastDelegateInline for different subscriber counts.
+
+using namespace DelegateLib;
+
+static const int CALLS = 2000000;
+
+static volatile int sink = 0;
+
+class Subscriber
+{
+public:
+    void Func(int value) { m_value += value; }
+    int m_value = 0;
+};
+
+static void FreeSubscriber(int value) { sink = value; }
+
+template <class Container>
+static void FanOut(const std::string& name, int subscribers)
+{
+    std::vector<Subscriber> objects(subscribers);
+    Container container;
+    for (int i = 0; i < subscribers; i++)
+    {
+        // Alternate free and member function targets
+        if (i % 2)
+            container += MakeDelegate(&objects[i], &Subscriber::Func);
+        else
+            container += MakeDelegate(&FreeSubscriber);
+    }
+
+    // Total target calls are constant for each subscriber count
+    const int broadcasts = CALLS / subscribers;
+    Stopwatch sw;
+    for (int i = 0; i < broadcasts; i++)
+        container(i);
+    double ns = sw.ElapsedNs();
+
+    BenchmarkReport(name + " " + std::to_string(subscribers) + " subscribers",
+        ns / (static_cast<double>(broadcasts) * subscribers), "ns/target");
+}
+
+template <class Container>
+static void Subscribe(const std::string& name)
+{
+    const int SUBSCRIBERS = 1024;
+    Container container;
+    std::uint64_t allocs = GetAllocCount();
+    for (int i = 0; i < SUBSCRIBERS; i++)
+        container += MakeDelegate(&FreeSubscriber);
+    BenchmarkReport(name + " subscribe", static_cast<double>(GetAllocCount() - allocs) / SUBSCRIBERS, "allocs/target");
+}
+
+void MulticastFanOut_BM()
+{
+    for (int subscribers : { 1, 8, 64, 1024 })
+    {
+        FanOut<MulticastDelegate<void(int)>>("MulticastDelegate", subscribers);
+        FanOut<MulticastDelegateInline<void(int)>>("MulticastDelegateInline", subscribers);
+    }
+
+    Subscribe<MulticastDelegate<void(int)>>("MulticastDelegate");
+    Subscribe<MulticastDelegateInline<void(int)>>("MulticastDelegateInline");
+}
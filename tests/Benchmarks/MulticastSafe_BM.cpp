@@ -0,0 +1,158 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// MulticastSafe_BM.cpp
+// MulticastDelegateSafe copy-on-write snapshot invocation compared against the
+// legacy container, which held a lock for the entire broadcast.
+
+using namespace DelegateLib;
+
+static const int SUBSCRIBERS = 8;
+static const int BROADCASTS = 100000;
+
+namespace Legacy
+{
+    // Legacy MulticastDelegateSafe. Every operation holds the container lock.
+    class MulticastDelegateSafe
+    {
+    public:
+        void operator()(int value) {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            m_delegates(value);
+        }
+        void operator+=(const Delegate<void(int)>& delegate) {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            m_delegates += delegate;
+        }
+        void operator-=(const Delegate<void(int)>& delegate) {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            m_delegates -= delegate;
+        }
+
+    private:
+        std::mutex m_lock;
+        MulticastDelegate<void(int)> m_delegates;
+    };
+}
+
+static std::atomic<int> sink(0);
+
+static void Subscriber(int value) { sink.fetch_add(value, std::memory_order_relaxed); }
+static void Churn(int) {}
+static void SlowSubscriber(int) { std::this_thread::sleep_for(std::chrono::microseconds(500)); }
+
+template <class Container>
+static void BroadcastScaling(const std::string& name, int publishers)
+{
+    Container container;
+    for (int i = 0; i < SUBSCRIBERS; i++)
+        container += MakeDelegate(&Subscriber);
+
+    const int perPublisher = BROADCASTS / publishers;
+    Stopwatch sw;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < publishers; p++)
+    {
+        threads.emplace_back([&container, perPublisher]() {
+            for (int i = 0; i < perPublisher; i++)
+                container(1);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    double ns = sw.ElapsedNs();
+
+    BenchmarkReport(name + " " + std::to_string(publishers) + " publishers",
+        (perPublisher * publishers) / (ns / 1e9), "broadcasts/sec");
+}
+
+template <class Container>
+static void BroadcastChurn(const std::string& name)
+{
+    Container container;
+    for (int i = 0; i < SUBSCRIBERS; i++)
+        container += MakeDelegate(&Subscriber);
+
+    // Writer continuously subscribes and unsubscribes
+    std::atomic<bool> done(false);
+    std::thread writer([&container, &done]() {
+        while (!done)
+        {
+            container += MakeDelegate(&Churn);
+            container -= MakeDelegate(&Churn);
+        }
+    });
+
+    double maxNs = 0;
+    Stopwatch total;
+    for (int i = 0; i < BROADCASTS / 10; i++)
+    {
+        Stopwatch sw;
+        container(1);
+        double ns = sw.ElapsedNs();
+        if (ns > maxNs)
+            maxNs = ns;
+    }
+    double totalNs = total.ElapsedNs();
+    done = true;
+    writer.join();
+
+    BenchmarkReport(name + " broadcast with churn mean", totalNs / (BROADCASTS / 10), "ns");
+    BenchmarkReport(name + " broadcast with churn max", maxNs, "ns");
+}
+
+template <class Container>
+static void SubscribeWhileSlow(const std::string& name)
+{
+    Container container;
+    container += MakeDelegate(&SlowSubscriber);
+
+    // Publisher continuously invokes a slow subscriber
+    std::atomic<bool> done(false);
+    std::thread publisher([&container, &done]() {
+        while (!done)
+            container(1);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // Subscribe at intervals so the publisher is mid-broadcast
+    const int LOOPS = 20;
+    double totalNs = 0;
+    double maxNs = 0;
+    for (int i = 0; i < LOOPS; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(300));
+        Stopwatch sw;
+        container += MakeDelegate(&Churn);
+        container -= MakeDelegate(&Churn);
+        double ns = sw.ElapsedNs();
+        totalNs += ns;
+        if (ns > maxNs)
+            maxNs = ns;
+    }
+    done = true;
+    publisher.join();
+
+    BenchmarkReport(name + " subscribe with slow subscriber mean", totalNs / LOOPS, "ns");
+    BenchmarkReport(name + " subscribe with slow subscriber max", maxNs, "ns");
+}
+
+void MulticastSafe_BM()
+{
+    for (int publishers : { 1, 2, 4 })
+    {
+        BroadcastScaling<Legacy::MulticastDelegateSafe>("Legacy MulticastDelegateSafe", publishers);
+        BroadcastScaling<MulticastDelegateSafe<void(int)>>("MulticastDelegateSafe", publishers);
+    }
+
+    BroadcastChurn<Legacy::MulticastDelegateSafe>("Legacy MulticastDelegateSafe");
+    BroadcastChurn<MulticastDelegateSafe<void(int)>>("MulticastDelegateSafe");
+
+    SubscribeWhileSlow<Legacy::MulticastDelegateSafe>("Legacy MulticastDelegateSafe");
+    SubscribeWhileSlow<MulticastDelegateSafe<void(int)>>("MulticastDelegateSafe");
+}
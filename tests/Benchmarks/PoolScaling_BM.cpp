@@ -0,0 +1,66 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "ThreadPool.h"
+#include "Benchmark.h"
+#include <algorithm>
+#include <string>
+#include <thread>
+
+// PoolScaling_BM.cpp
+// Stateless handler throughput of a ThreadPool with 1 to the number of hardware 
+// threads workers, compared against a single WorkerThread. Each handler performs 
+// a fixed amount of CPU work so throughput scales with the number of free cores.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 20000;
+static const int WORK = 2000;
+
+static std::atomic<int> recvCnt(0);
+
+static void RecvFunc(int value) 
+{ 
+    // Simulate a short CPU bound stateless handler
+    volatile unsigned sum = 0;
+    for (int i = 0; i < WORK; i++)
+        sum += static_cast<unsigned>(value * i);
+    recvCnt++; 
+}
+
+template <class TThread>
+static double Throughput(TThread& thread)
+{
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&RecvFunc, thread);
+
+    Stopwatch sw;
+    for (int i = 0; i < MESSAGES; i++)
+        delegate(i);
+    WaitForCount(recvCnt, MESSAGES);
+    return MESSAGES / (sw.ElapsedNs() / 1e9);
+}
+
+void PoolScaling_BM()
+{
+    WorkerThread workerThread("PoolScaling_BM");
+    workerThread.CreateThread();
+    BenchmarkReport("WorkerThread stateless handler", Throughput(workerThread), "msgs/sec");
+    workerThread.ExitThread();
+
+    const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        ThreadPool pool("PoolScaling_BM", threads);
+        pool.CreateThread();
+        double msgsPerSec = Throughput(pool);
+        BenchmarkReport("ThreadPool " + std::to_string(threads) + " workers stateless handler", 
+            msgsPerSec, "msgs/sec");
+        BenchmarkReport("ThreadPool " + std::to_string(threads) + " workers steals", 
+            static_cast<double>(pool.GetStealCount()), "msgs");
+        pool.ExitThread();
+
+        // Include the hardware thread count when not a power of two
+        if (threads < maxThreads && threads * 2 > maxThreads)
+            threads = maxThreads / 2;
+    }
+}
@@ -0,0 +1,91 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// PriorityLatency_BM.cpp
+// WorkerThread dispatch to invoke latency of periodic probe messages while
+// a producer thread floods the same thread with low priority messages. The
+// FIFO baseline dispatches the probes at the flood priority.
+
+using namespace DelegateLib;
+
+static const int PROBES = 2000;
+static const size_t FLOOD_DEPTH = 1000;
+static const auto FLOOD_WORK = std::chrono::microseconds(2);
+
+static std::atomic<int> probeCnt(0);
+static std::vector<long long> latencies;
+
+static long long NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void FloodFunc(int)
+{
+    // Simulate a short handler
+    auto end = std::chrono::steady_clock::now() + FLOOD_WORK;
+    while (std::chrono::steady_clock::now() < end) {}
+}
+
+static void ProbeFunc(long long sentNs)
+{
+    latencies.push_back(NowNs() - sentNs);
+    probeCnt++;
+}
+
+static double Percentile(std::vector<long long>& values, double percentile)
+{
+    size_t index = static_cast<size_t>(percentile * (values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return static_cast<double>(values[index]);
+}
+
+static void PriorityLatency(const std::string& name, DelegatePriority floodPriority, DelegatePriority probePriority)
+{
+    WorkerThread workerThread("PriorityLatency_BM");
+    workerThread.CreateThread();
+
+    probeCnt = 0;
+    latencies.clear();
+    latencies.reserve(PROBES);
+
+    // Keep the queue full of flood messages until all probes are invoked
+    std::atomic<bool> flooding(true);
+    std::thread flood([&]() {
+        auto delegate = MakeDelegate(&FloodFunc, workerThread, floodPriority);
+        while (flooding)
+        {
+            if (workerThread.GetQueueSize() < FLOOD_DEPTH)
+                delegate(0);
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    auto probe = MakeDelegate(&ProbeFunc, workerThread, probePriority);
+    for (int i = 0; i < PROBES; i++)
+    {
+        probe(NowNs());
+        WaitForCount(probeCnt, i + 1);
+    }
+    flooding = false;
+    flood.join();
+    workerThread.ExitThread();
+
+    BenchmarkReport(name + " p50", Percentile(latencies, 0.50) / 1000, "us");
+    BenchmarkReport(name + " p99", Percentile(latencies, 0.99) / 1000, "us");
+    BenchmarkReport(name + " max", Percentile(latencies, 1.0) / 1000, "us");
+}
+
+void PriorityLatency_BM()
+{
+    PriorityLatency("Probe latency FIFO", DelegatePriority::NORMAL, DelegatePriority::NORMAL);
+    PriorityLatency("Probe latency HIGH over LOW flood", DelegatePriority::LOW, DelegatePriority::HIGH);
+}
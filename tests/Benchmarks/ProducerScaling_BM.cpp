@@ -0,0 +1,62 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "WorkerThreadLockFree.h"
+#include "Benchmark.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// ProducerScaling_BM.cpp
+// Async dispatch throughput with 1 to 32 producer threads sending to one
+// consumer thread. Compares the mutex WorkerThread against WorkerThreadLockFree.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 320000;
+static const int MAX_PRODUCERS = 32;
+
+static std::atomic<int> recvCnt(0);
+
+static void RecvFunc(int) { recvCnt++; }
+
+template <class TThread>
+static void ProducerScaling(const std::string& name, TThread& thread)
+{
+    for (int producers = 1; producers <= MAX_PRODUCERS; producers *= 2)
+    {
+        recvCnt = 0;
+        const int perProducer = MESSAGES / producers;
+        auto delegate = MakeDelegate(&RecvFunc, thread);
+
+        Stopwatch sw;
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++)
+        {
+            threads.emplace_back([&delegate, perProducer]() {
+                auto local = delegate;
+                for (int i = 0; i < perProducer; i++)
+                    local(i);
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+        WaitForCount(recvCnt, perProducer * producers);
+        double ns = sw.ElapsedNs();
+
+        BenchmarkReport(name + " " + std::to_string(producers) + " producers", 
+            perProducer * producers / (ns / 1e9), "msgs/sec");
+    }
+}
+
+void ProducerScaling_BM()
+{
+    WorkerThread workerThread("ProducerScaling_BM");
+    workerThread.CreateThread();
+    ProducerScaling("WorkerThread", workerThread);
+    workerThread.ExitThread();
+
+    WorkerThreadLockFree workerThreadLockFree("ProducerScalingLockFree_BM");
+    workerThreadLockFree.CreateThread();
+    ProducerScaling("WorkerThreadLockFree", workerThreadLockFree);
+    workerThreadLockFree.ExitThread();
+}
@@ -0,0 +1,69 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "ThreadPool.h"
+#include "Strand.h"
+#include "Benchmark.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// Strand_BM.cpp
+// Serialized active object throughput. Each object owning a dedicated WorkerThread 
+// is measured against each object owning a Strand sharing one ThreadPool.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 200000;
+
+static std::atomic<int> recvCnt(0);
+
+class ActiveObject
+{
+public:
+    void Recv(int value) { m_value += value; recvCnt++; }
+private:
+    int m_value = 0;
+};
+
+template <class TThread>
+static void Throughput(const std::string& name, std::vector<std::unique_ptr<TThread>>& threads)
+{
+    std::vector<ActiveObject> objects(threads.size());
+    recvCnt = 0;
+
+    Stopwatch sw;
+    for (int i = 0; i < MESSAGES; i++)
+    {
+        size_t index = i % objects.size();
+        MakeDelegate(&objects[index], &ActiveObject::Recv, *threads[index]).AsyncInvoke(i);
+    }
+    WaitForCount(recvCnt, MESSAGES);
+    BenchmarkReport(name + " " + std::to_string(objects.size()) + " objects", 
+        MESSAGES / (sw.ElapsedNs() / 1e9), "msgs/sec");
+}
+
+void Strand_BM()
+{
+    {
+        std::vector<std::unique_ptr<WorkerThread>> threads;
+        for (int i = 0; i < 64; i++)
+        {
+            threads.push_back(std::unique_ptr<WorkerThread>(new WorkerThread("Strand_BM")));
+            threads.back()->CreateThread();
+        }
+        Throughput("WorkerThread per object", threads);
+        for (auto& thread : threads)
+            thread->ExitThread();
+    }
+
+    ThreadPool pool("Strand_BM");
+    pool.CreateThread();
+    for (int objects : { 64, 1000, 10000 })
+    {
+        std::vector<std::unique_ptr<Strand>> strands;
+        for (int i = 0; i < objects; i++)
+            strands.push_back(std::unique_ptr<Strand>(new Strand(pool)));
+        Throughput("Strand per object on " + std::to_string(pool.GetThreadCount()) + " pool threads", strands);
+    }
+    pool.ExitThread();
+}
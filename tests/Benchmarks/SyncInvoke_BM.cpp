@@ -0,0 +1,62 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+// SyncInvoke_BM.cpp
+// Synchronous invoke cost of DelegateFree, DelegateMember, DelegateMemberSp and
+// DelegateFunction compared to calling the target function directly.
+
+using namespace DelegateLib;
+
+static const int LOOPS = 10000000;
+
+static volatile int sink = 0;
+
+class Target
+{
+public:
+    int Func(int value) { return m_value += value; }
+    int m_value = 0;
+};
+
+static int FreeTarget(int value) { sink = value; return value; }
+
+template <class Callable>
+static void Invoke(const std::string& name, Callable& callable)
+{
+    std::uint64_t allocs = GetAllocCount();
+    int total = 0;
+    Stopwatch sw;
+    for (int i = 0; i < LOOPS; i++)
+        total += callable(i);
+    double ns = sw.ElapsedNs();
+    sink = total;
+
+    BenchmarkReport(name + " sync invoke", ns / LOOPS, "ns/call");
+    BenchmarkReport(name + " sync invoke", static_cast<double>(GetAllocCount() - allocs) / LOOPS, "allocs/call");
+}
+
+void SyncInvoke_BM()
+{
+    auto target = std::make_shared<Target>();
+    auto lambda = [target](int value) { return target->Func(value); };
+
+    // Baselines call through a function pointer so the call is not inlined away
+    int (*volatile freePtr)(int) = &FreeTarget;
+    auto direct = [freePtr](int value) { return freePtr(value); };
+    Invoke("Function pointer", direct);
+
+    auto freeDelegate = MakeDelegate(&FreeTarget);
+    Invoke("DelegateFree", freeDelegate);
+
+    auto memberDelegate = MakeDelegate(target.get(), &Target::Func);
+    Invoke("DelegateMember", memberDelegate);
+
+    auto memberSpDelegate = MakeDelegate(target, &Target::Func);
+    Invoke("DelegateMemberSp", memberSpDelegate);
+
+    auto functionDelegate = MakeDelegate(std::function<int(int)>(lambda));
+    Invoke("DelegateFunction", functionDelegate);
+}
@@ -0,0 +1,52 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <string>
+
+// ThreadStats_BM.cpp
+// WorkerThread asynchronous dispatch throughput with the thread instrumentation
+// disabled versus enabled, and the recorded queue wait and handler time.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 200000;
+
+static std::atomic<int> recvCnt(0);
+
+static void RecvFunc(int)
+{
+    recvCnt++;
+}
+
+static void ThreadStats(const std::string& name, bool enabled)
+{
+    WorkerThread workerThread("ThreadStats_BM");
+    workerThread.CreateThread();
+    workerThread.GetStats().SetEnabled(enabled);
+
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&RecvFunc, workerThread);
+
+    Stopwatch sw;
+    for (int i = 0; i < MESSAGES; i++)
+        delegate(i);
+    WaitForCount(recvCnt, MESSAGES);
+    double ns = sw.ElapsedNs();
+
+    BenchmarkReport(name + " throughput", MESSAGES / (ns / 1e9), "msgs/sec");
+    if (enabled)
+    {
+        auto snapshot = workerThread.GetStats().GetSnapshot();
+        BenchmarkReport(name + " max queue depth", static_cast<double>(snapshot.maxQueueDepth), "msgs");
+        BenchmarkReport(name + " queue wait p50", static_cast<double>(snapshot.queueWait.PercentileNs(0.50)), "ns");
+        BenchmarkReport(name + " handler p50", static_cast<double>(snapshot.handlerTime.PercentileNs(0.50)), "ns");
+    }
+
+    workerThread.ExitThread();
+}
+
+void ThreadStats_BM()
+{
+    ThreadStats("Async dispatch stats disabled", false);
+    ThreadStats("Async dispatch stats enabled", true);
+}
@@ -0,0 +1,188 @@
+#include "DelegateLib.h"
+#include "Timer.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Timer_BM.cpp
+// Timer start, stop and per tick processing cost with many timers. The timing
+// wheel TimerService is compared against an emulation of the legacy Timer, which
+// kept all timers in a global list scanned on every 100 ms tick. Also measures
+// the expiration lateness and jitter of sub-millisecond timers.
+
+using namespace DelegateLib;
+
+static const int TIMERS = 10000;
+static const int TICKS = 200;
+
+static std::chrono::milliseconds TimerTimeout(int i)
+{
+    // Timeouts spread from 10 ms to 1000 ms
+    return std::chrono::milliseconds((i % 100 + 1) * 10);
+}
+
+namespace Legacy
+{
+    // Legacy Timer implementation. Global list, O(n) start and a full scan per tick.
+    class Timer
+    {
+    public:
+        UnicastDelegate<void(void)> Expired;
+
+        static std::chrono::milliseconds GetTime()
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch());
+        }
+
+        ~Timer()
+        {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            m_timers.remove(this);
+        }
+
+        void Start(std::chrono::milliseconds timeout)
+        {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            m_timeout = timeout;
+            m_expireTime = GetTime();
+            m_enabled = true;
+            m_timers.remove(this);
+            m_timers.push_back(this);
+        }
+
+        void Stop()
+        {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            m_enabled = false;
+            m_timerStopped = true;
+        }
+
+        static void ProcessTimers()
+        {
+            const std::lock_guard<std::mutex> lock(m_lock);
+            if (m_timerStopped)
+            {
+                m_timers.remove_if([](Timer* t) { return !t->m_enabled; });
+                m_timerStopped = false;
+            }
+            for (Timer* timer : m_timers)
+                timer->CheckExpired();
+        }
+
+    private:
+        void CheckExpired()
+        {
+            if (!m_enabled)
+                return;
+            if (GetTime() - m_expireTime < m_timeout)
+                return;
+            m_expireTime += m_timeout;
+            if (GetTime() - m_expireTime > m_timeout)
+                m_expireTime = GetTime();
+            if (Expired)
+                Expired();
+        }
+
+        static std::mutex m_lock;
+        static bool m_timerStopped;
+        static xlist<Timer*> m_timers;
+
+        std::chrono::milliseconds m_timeout = std::chrono::milliseconds(0);
+        std::chrono::milliseconds m_expireTime = std::chrono::milliseconds(0);
+        bool m_enabled = false;
+    };
+
+    std::mutex Timer::m_lock;
+    bool Timer::m_timerStopped = false;
+    xlist<Timer*> Timer::m_timers;
+}
+
+static int expiredCnt = 0;
+
+static void ExpiredFunc() { expiredCnt++; }
+
+template <class T, class StartFunc, class ProcessFunc>
+static void TimerBenchmark(const std::string& name, StartFunc start, ProcessFunc process)
+{
+    std::vector<std::unique_ptr<T>> timers;
+    for (int i = 0; i < TIMERS; i++)
+    {
+        timers.emplace_back(new T());
+        timers.back()->Expired = MakeDelegate(&ExpiredFunc);
+    }
+
+    Stopwatch sw;
+    for (int i = 0; i < TIMERS; i++)
+        start(*timers[i], TimerTimeout(i));
+    BenchmarkReport(name + " start", sw.ElapsedNs() / TIMERS, "ns/timer");
+
+    sw.Reset();
+    for (int i = 0; i < TIMERS; i++)
+        start(*timers[i], TimerTimeout(i));
+    BenchmarkReport(name + " restart", sw.ElapsedNs() / TIMERS, "ns/timer");
+
+    // Service the timers every 1 ms. Only the processing time is measured.
+    expiredCnt = 0;
+    double processNs = 0;
+    for (int tick = 0; tick < TICKS; tick++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        sw.Reset();
+        process();
+        processNs += sw.ElapsedNs();
+    }
+    BenchmarkReport(name + " process", processNs / TICKS, "ns/tick");
+    BenchmarkReport(name + " process", expiredCnt > 0 ? processNs / expiredCnt : 0, "ns/expiry");
+
+    sw.Reset();
+    for (int i = 0; i < TIMERS; i++)
+        timers[i]->Stop();
+    process();
+    BenchmarkReport(name + " stop", sw.ElapsedNs() / TIMERS, "ns/timer");
+}
+
+static void TimerJitter(std::chrono::microseconds period)
+{
+    WorkerThread workerThread("TimerJitter_BM");
+    workerThread.CreateThread();
+
+    static std::atomic<int> cnt(0);
+    cnt = 0;
+    Timer timer;
+    timer.Expired = MakeDelegate(+[]() { cnt++; });
+    timer.SetMeasure(true);
+    timer.Start(period, workerThread);
+    WaitForCount(cnt, 500);
+    timer.Stop();
+
+    TimerStats stats = timer.GetStats();
+    const std::string name = "Timer " + std::to_string(period.count()) + " us period";
+    BenchmarkReport(name + " mean late", stats.meanLate, "us");
+    BenchmarkReport(name + " max late", static_cast<double>(stats.maxLate.count()), "us");
+    BenchmarkReport(name + " jitter", stats.jitter, "us");
+    BenchmarkReport(name + " overruns", static_cast<double>(stats.overruns), "count");
+
+    workerThread.ExitThread();
+}
+
+void Timer_BM()
+{
+    const std::string timers = std::to_string(TIMERS) + " timers";
+
+    TimerBenchmark<Legacy::Timer>("Legacy Timer list " + timers,
+        [](Legacy::Timer& timer, std::chrono::milliseconds timeout) { timer.Start(timeout); },
+        []() { Legacy::Timer::ProcessTimers(); });
+
+    TimerService service(nullptr);
+    TimerBenchmark<Timer>("Timer wheel " + timers,
+        [&service](Timer& timer, std::chrono::milliseconds timeout) { timer.Start(timeout, service); },
+        [&service]() { service.ProcessTimers(); });
+
+    TimerJitter(std::chrono::microseconds(250));
+    TimerJitter(std::chrono::microseconds(1000));
+}
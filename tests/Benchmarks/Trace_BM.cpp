@@ -0,0 +1,50 @@
+#include "DelegateLib.h"
+#include "WorkerThreadStd.h"
+#include "Benchmark.h"
+#include <string>
+
+// Trace_BM.cpp
+// WorkerThread asynchronous dispatch throughput with the sampling tracer
+// disabled, sampling one of every 1000 messages, and tracing every message.
+
+using namespace DelegateLib;
+
+static const int MESSAGES = 200000;
+
+static std::atomic<int> recvCnt(0);
+
+static void RecvFunc(int)
+{
+    recvCnt++;
+}
+
+static void Trace(const std::string& name, std::uint32_t sampleRate)
+{
+    WorkerThread workerThread("Trace_BM");
+    workerThread.CreateThread();
+
+    auto& tracer = DelegateTracer::GetInstance();
+    tracer.Clear();
+    tracer.SetSampleRate(sampleRate);
+
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&RecvFunc, workerThread);
+
+    Stopwatch sw;
+    for (int i = 0; i < MESSAGES; i++)
+        delegate(i);
+    WaitForCount(recvCnt, MESSAGES);
+    double ns = sw.ElapsedNs();
+
+    tracer.SetSampleRate(0);
+    BenchmarkReport(name + " throughput", MESSAGES / (ns / 1e9), "msgs/sec");
+
+    workerThread.ExitThread();
+}
+
+void Trace_BM()
+{
+    Trace("Async dispatch trace disabled", 0);
+    Trace("Async dispatch trace 1 in 1000", 1000);
+    Trace("Async dispatch trace all", 1);
+}
@@ -0,0 +1,55 @@
+#include "DelegateLib.h"
+#include "Benchmark.h"
+#include <string>
+#include <vector>
+
+// Unsubscribe_BM.cpp
+// MulticastDelegate subscribe/unsubscribe churn cost with a large number of
+// subscribers using a linear search, the hash index and subscription handles.
+
+using namespace DelegateLib;
+
+static const int CHURN = 2000;
+
+class Subscriber
+{
+public:
+    void Func(int value) { m_value += value; }
+    int m_value = 0;
+};
+
+enum class RemoveMode { LINEAR, INDEX, HANDLE };
+
+static void Churn(const std::string& name, int subscribers, RemoveMode mode)
+{
+    std::vector<Subscriber> objects(subscribers + 1);
+    MulticastDelegate<void(int)> container;
+    container.EnableIndex(mode == RemoveMode::INDEX);
+    for (int i = 0; i < subscribers; i++)
+        container += MakeDelegate(&objects[i], &Subscriber::Func);
+
+    // The churned subscriber is always at the end of the invocation list
+    Subscriber& churn = objects[subscribers];
+    Stopwatch sw;
+    for (int i = 0; i < CHURN; i++)
+    {
+        auto handle = container += MakeDelegate(&churn, &Subscriber::Func);
+        if (mode == RemoveMode::HANDLE)
+            container -= handle;
+        else
+            container -= MakeDelegate(&churn, &Subscriber::Func);
+    }
+    double ns = sw.ElapsedNs();
+
+    BenchmarkReport(name + " " + std::to_string(subscribers) + " subscribers", ns / CHURN, "ns/churn");
+}
+
+void Unsubscribe_BM()
+{
+    for (int subscribers : { 100, 10000, 50000 })
+    {
+        Churn("MulticastDelegate remove linear", subscribers, RemoveMode::LINEAR);
+        Churn("MulticastDelegate remove index", subscribers, RemoveMode::INDEX);
+        Churn("MulticastDelegate remove handle", subscribers, RemoveMode::HANDLE);
+    }
+}
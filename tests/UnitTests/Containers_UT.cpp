@@ -3,12 +3,18 @@
 #include <iostream>
 #include <set>
 #include <cstring>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <vector>
 #include "WorkerThreadStd.h"
 
 using namespace DelegateLib;
 using namespace std;
 using namespace UnitTestData;
 
+static WorkerThread workerThread("Containers_UT");
+
 static int lambda1Int = 0;
 static int lambda2Int = 0;
 static int funcInt = 0;
@@ -117,6 +123,8 @@ static void MulticastDelegateTests()
     std::function lambda1 = [](int i) { lambda1Int = i; };
     std::function lambda2 = [](int i) { lambda2Int = i; };
 
+#if defined(__cpp_rtti) || defined(_CPPRTTI)
+    // Removing a std::function target requires RTTI. See DelegateFunction<>.
     funcInt = 0, classInt = 0, lambda1Int = 0, lambda2Int = 0;
     src.Clear();
     src += MakeDelegate(&TFreeFunc);
@@ -144,6 +152,7 @@ static void MulticastDelegateTests()
     ASSERT_TRUE(lambda1Int == TEST_INT);
     ASSERT_TRUE(lambda2Int == 0);
     ASSERT_TRUE(src.Size() == 3);
+#endif
 
     funcInt = 0, classInt = 0, lambda1Int = 0, lambda2Int = 0;
     src.Clear();
@@ -194,6 +203,66 @@ static void MulticastDelegateTests()
 #endif
 }
 
+static std::vector<int> inlineOrder;
+static void InlineFunc1(int) { inlineOrder.push_back(1); }
+static void InlineFunc2(int) { inlineOrder.push_back(2); }
+static void InlineFunc3(int) { inlineOrder.push_back(3); }
+static void InlineAsyncFunc(int) { }
+
+template <std::size_t InlineSize>
+static void MulticastDelegateInlineTests()
+{
+    MulticastDelegateInline<void(int), InlineSize> src;
+    src += MakeDelegate(&FreeFuncInt1);
+    ASSERT_TRUE(src.Size() == 1);
+    auto dest = std::move(src);
+    ASSERT_TRUE(src.Size() == 0);
+    ASSERT_TRUE(dest.Size() == 1);
+
+    MulticastDelegateInline<void(int), InlineSize> src2(dest);
+    ASSERT_TRUE(src2.Size() == 1);
+    ASSERT_TRUE(dest.Size() == 1);
+
+    src = dest;
+    ASSERT_TRUE(src.Size() == 1);
+    src = nullptr;
+    ASSERT_TRUE(src.Empty());
+
+    // Insertion order preserved through growth and removal
+    inlineOrder.clear();
+    TClass testClass;
+    std::function<void(int)> func = [](int) { inlineOrder.push_back(4); };
+    for (int i = 0; i < 10; i++) {
+        src += MakeDelegate(&InlineFunc1);
+        src += MakeDelegate(&InlineFunc2);
+        src += MakeDelegate(&InlineFunc3);
+    }
+    src += MakeDelegate(&testClass, &TClass::Func);
+    src += MakeDelegate(func);
+    src += MakeDelegate(&InlineAsyncFunc, workerThread);
+    src += MakeDelegate(&InlineAsyncFunc, workerThread, WAIT_INFINITE);
+    ASSERT_TRUE(src.Size() == 34);
+
+    src -= MakeDelegate(&InlineFunc2);
+    src -= MakeDelegate(&testClass, &TClass::Func);
+    src -= MakeDelegate(&InlineAsyncFunc, workerThread);
+    src -= MakeDelegate(&InlineAsyncFunc, workerThread, WAIT_INFINITE);
+    ASSERT_TRUE(src.Size() == 30);
+
+    src(TEST_INT);
+    ASSERT_TRUE(inlineOrder.size() == 30);
+    ASSERT_TRUE(inlineOrder[0] == 1 && inlineOrder[1] == 3 && inlineOrder[2] == 1);
+    ASSERT_TRUE(inlineOrder[3] == 2 && inlineOrder.back() == 4);
+
+    dest = src;
+    ASSERT_TRUE(dest.Size() == 30);
+    inlineOrder.clear();
+    dest.Broadcast(TEST_INT);
+    ASSERT_TRUE(inlineOrder.size() == 30);
+    src.Clear();
+    dest.Clear();
+}
+
 static void MulticastDelegateSafeTests()
 {
     MulticastDelegateSafe<void(int)> src;
@@ -238,9 +307,157 @@ static void MulticastDelegateSafeTests()
     src.Broadcast(TEST_INT);
 }
 
+static MulticastDelegateSafe<void(int)> selfRemoveSafe;
+static int selfRemoveCnt = 0;
+
+static void SelfRemoveFunc(int)
+{
+    // Remove this delegate from within the callback
+    selfRemoveCnt++;
+    selfRemoveSafe -= MakeDelegate(&SelfRemoveFunc);
+    selfRemoveSafe += MakeDelegate(&FreeFuncInt1);
+}
+
+static void MulticastDelegateSafeSnapshotTests()
+{
+    // Insert and remove within a callback does not deadlock. Changes take 
+    // effect on the next invocation.
+    selfRemoveCnt = 0;
+    selfRemoveSafe += MakeDelegate(&SelfRemoveFunc);
+    selfRemoveSafe(TEST_INT);
+    ASSERT_TRUE(selfRemoveCnt == 1);
+    ASSERT_TRUE(selfRemoveSafe.Size() == 1);
+    selfRemoveSafe(TEST_INT);
+    ASSERT_TRUE(selfRemoveCnt == 1);
+    selfRemoveSafe.Clear();
+    ASSERT_TRUE(selfRemoveSafe.Empty());
+
+    // Concurrent invoke, insert and remove
+    MulticastDelegateSafe<void(int)> safe;
+    std::atomic<int> cnt(0);
+    std::function<void(int)> func = [&cnt](int) { cnt++; };
+    safe += MakeDelegate(func);
+
+    std::atomic<bool> done(false);
+    std::thread writer([&safe, &done]() {
+        for (int i = 0; i < 1000; i++) {
+            safe += MakeDelegate(&FreeFuncInt1);
+            safe -= MakeDelegate(&FreeFuncInt1);
+        }
+        done = true;
+    });
+    int invokes = 0;
+    while (!done) {
+        safe(TEST_INT);
+        invokes++;
+    }
+    writer.join();
+    ASSERT_TRUE(cnt == invokes);
+    ASSERT_TRUE(safe.Size() == 1);
+
+    // Concurrent broadcast to a shared blocking async subscriber
+    WorkerThread waitThread("Containers_UT_Wait");
+    waitThread.CreateThread();
+    MulticastDelegateSafe<void(int)> broadcast;
+    std::atomic<int> waitCnt(0);
+    std::function<void(int)> waitFunc = [&waitCnt](int) { waitCnt++; };
+    broadcast += MakeDelegate(waitFunc, waitThread, WAIT_INFINITE);
+    const int PUBLISHERS = 4;
+    const int BROADCASTS = 500;
+    std::vector<std::thread> publishers;
+    for (int p = 0; p < PUBLISHERS; p++) {
+        publishers.emplace_back([&broadcast]() {
+            for (int i = 0; i < BROADCASTS; i++)
+                broadcast(TEST_INT);
+        });
+    }
+    for (auto& publisher : publishers)
+        publisher.join();
+    ASSERT_TRUE(waitCnt == PUBLISHERS * BROADCASTS);
+    broadcast.Clear();
+    waitThread.ExitThread();
+}
+
+static std::vector<int> handleOrder;
+static void HandleFunc1(int) { handleOrder.push_back(1); }
+static void HandleFunc2(int) { handleOrder.push_back(2); }
+static void HandleFunc3(int) { handleOrder.push_back(3); }
+static void HandleAsyncFunc(int) { }
+
+static void MulticastDelegateHandleTests(bool indexed)
+{
+    MulticastDelegate<void(int)> src;
+    src.EnableIndex(indexed);
+
+    // Remove using subscription handles preserves order
+    auto h1 = src += MakeDelegate(&HandleFunc1);
+    auto h2 = src += MakeDelegate(&HandleFunc2);
+    auto h3 = src += MakeDelegate(&HandleFunc3);
+    ASSERT_TRUE(h1 && h2 && h3);
+    ASSERT_TRUE(h1 != h2 && h2 != h3);
+    ASSERT_TRUE(!DelegateHandle());
+    handleOrder.clear();
+    src -= h2;
+    src(0);
+    ASSERT_TRUE(handleOrder == std::vector<int>({ 1, 3 }));
+    src -= h2;      // Already removed
+    ASSERT_TRUE(src.Size() == 2);
+
+    // Remove by value removes the first inserted match
+    auto h4 = src += MakeDelegate(&HandleFunc1);
+    src -= MakeDelegate(&HandleFunc1);
+    handleOrder.clear();
+    src(0);
+    ASSERT_TRUE(handleOrder == std::vector<int>({ 3, 1 }));
+    src -= h1;      // Removed by value above
+    ASSERT_TRUE(src.Size() == 2);
+
+    // Object, function and thread distinguish delegates
+    TClass testClass1, testClass2;
+    src += MakeDelegate(&testClass1, &TClass::Func);
+    src += MakeDelegate(&testClass2, &TClass::Func);
+    src += MakeDelegate(&HandleAsyncFunc, workerThread);
+    src -= MakeDelegate(&testClass2, &TClass::Func);
+    src -= MakeDelegate(&testClass2, &TClass::Func);
+    src -= MakeDelegate(&HandleAsyncFunc);
+    ASSERT_TRUE(src.Size() == 4);
+    src -= MakeDelegate(&HandleAsyncFunc, workerThread);
+    src -= MakeDelegate(&testClass1, &TClass::Func);
+    ASSERT_TRUE(src.Size() == 2);
+
+    // Handles survive a move and a copy
+    auto moved = std::move(src);
+    auto copied = moved;
+    moved -= h4;
+    ASSERT_TRUE(moved.Size() == 1);
+    ASSERT_TRUE(copied.Size() == 2);
+
+    // A handle from another container removes nothing
+    MulticastDelegate<void(int)> other;
+    auto foreign = other += MakeDelegate(&HandleFunc3);
+    copied -= foreign;
+    ASSERT_TRUE(copied.Size() == 2);
+    ASSERT_TRUE(other.Size() == 1);
+    copied -= h4;
+    ASSERT_TRUE(copied.Size() == 1);
+    copied += MakeDelegate(&HandleFunc1);
+
+    // Index enabled after insert
+    copied.EnableIndex(!indexed);
+    copied -= MakeDelegate(&HandleFunc1);
+    copied -= MakeDelegate(&HandleFunc3);
+    ASSERT_TRUE(copied.Empty());
+    src.Clear();
+}
+
 void Containers_UT()
 {
     UnicastDelegateTests();
     MulticastDelegateTests();
+    MulticastDelegateHandleTests(false);
+    MulticastDelegateHandleTests(true);
+    MulticastDelegateInlineTests<DEFAULT_INLINE_DELEGATE_SIZE>();
+    MulticastDelegateInlineTests<16>();
     MulticastDelegateSafeTests();
+    MulticastDelegateSafeSnapshotTests();
 }
\ No newline at end of file
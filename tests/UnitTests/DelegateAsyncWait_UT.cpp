@@ -3,6 +3,10 @@
 #include <iostream>
 #include <set>
 #include <cstring>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <vector>
 #include "WorkerThreadStd.h"
 
 using namespace DelegateLib;
@@ -24,6 +28,28 @@ namespace AsyncWait
 
     int TestReturn::val = 0;
 
+    struct CountReturn
+    {
+        CountReturn() = default;
+        CountReturn(const CountReturn& rhs) : data(rhs.data) { copies++; }
+        CountReturn(CountReturn&& rhs) noexcept : data(std::move(rhs.data)) { moves++; }
+        CountReturn& operator=(const CountReturn&) = default;
+        CountReturn& operator=(CountReturn&&) = default;
+        std::string data;
+        static int copies;
+        static int moves;
+    };
+
+    int CountReturn::copies = 0;
+    int CountReturn::moves = 0;
+
+    static CountReturn CountReturnFunc(const std::string& data)
+    {
+        CountReturn ret;
+        ret.data = data;
+        return ret;
+    }
+
     class TestReturnClass
     {
     public:
@@ -660,6 +686,222 @@ static void DelegateFunctionAsyncWaitTests()
     }
 }
 
+static std::atomic<int> completionCnt(0);
+static void CompletionSleep(int ms) 
+{ 
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms)); 
+    completionCnt++;
+}
+
+static void CompletionTests()
+{
+    // Completed call
+    Completion completion1;
+    ASSERT_TRUE(completion1.TryStart());
+    completion1.Complete();
+    ASSERT_TRUE(completion1.IsCompleted());
+    ASSERT_TRUE(completion1.Wait(std::chrono::milliseconds(0)));
+
+    // Abandoned call is not claimed
+    Completion completion2;
+    ASSERT_TRUE(!completion2.Wait(std::chrono::milliseconds(1)));
+    ASSERT_TRUE(!completion2.TryStart());
+
+    // Parked waiter woken by the destination thread
+    Completion completion3;
+    std::thread destination([&completion3]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_TRUE(completion3.TryStart());
+        completion3.Complete();
+    });
+    ASSERT_TRUE(completion3.Wait(WAIT_INFINITE));
+    destination.join();
+
+    // Timeout expires while the destination thread is busy; call not invoked
+    completionCnt = 0;
+    auto busy = MakeDelegate(&CompletionSleep, workerThread);
+    busy(50);
+    auto timeout = MakeDelegate(&CompletionSleep, workerThread, std::chrono::milliseconds(5));
+    timeout(0);
+    ASSERT_TRUE(!timeout.IsSuccess());
+
+    // Timeout expires after the destination thread claimed the call; caller waits
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (completionCnt != 1 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+    ASSERT_TRUE(completionCnt == 1);
+    auto claimed = MakeDelegate(&CompletionSleep, workerThread, std::chrono::milliseconds(20));
+    auto start = std::chrono::steady_clock::now();
+    claimed(100);
+    auto waited = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(claimed.IsSuccess());
+    ASSERT_TRUE(waited >= std::chrono::milliseconds(100));
+    ASSERT_TRUE(completionCnt == 2);
+
+    // Spin then yield before parking
+    Completion completion4;
+    std::thread destination2([&completion4]() {
+        ASSERT_TRUE(completion4.TryStart());
+        completion4.Complete();
+    });
+    ASSERT_TRUE(completion4.Wait(WAIT_INFINITE, SpinPolicy{ 1000, 8 }));
+    destination2.join();
+
+    Completion completion5;
+    ASSERT_TRUE(!completion5.Wait(std::chrono::milliseconds(1), SpinPolicy{ 1000, 1000000 }));
+
+    auto spinDel = MakeDelegate(&FreeFuncIntWithReturn1, workerThread, WAIT_INFINITE);
+    spinDel.SetSpinPolicy(SpinPolicy{ 1000, 8 });
+    auto spinCopy = spinDel;
+    ASSERT_TRUE(spinCopy.GetSpinPolicy().spins == 1000);
+    ASSERT_TRUE(spinCopy.GetSpinPolicy().yields == 8);
+    ASSERT_TRUE(spinCopy(TEST_INT) == TEST_INT);
+    ASSERT_TRUE(spinCopy.IsSuccess());
+}
+
+static void RetValSlotTests()
+{
+    const std::string data(1000, 'x');
+    auto del = MakeDelegate(&CountReturnFunc, workerThread, WAIT_INFINITE);
+
+    // Return value written once into the message slot and moved once to the caller
+    CountReturn::copies = CountReturn::moves = 0;
+    CountReturn ret = del(data);
+    ASSERT_TRUE(del.IsSuccess());
+    ASSERT_TRUE(ret.data == data);
+    ASSERT_TRUE(CountReturn::copies == 0);
+    ASSERT_TRUE(CountReturn::moves == 2);
+
+    CountReturn::copies = 0;
+    auto retOpt = del.AsyncInvoke(data);
+    ASSERT_TRUE(retOpt.has_value());
+    ASSERT_TRUE(retOpt->data == data);
+    ASSERT_TRUE(CountReturn::copies == 0);
+
+    // Timeout before the destination thread claims the call returns a default value
+    completionCnt = 0;
+    auto busy = MakeDelegate(&CompletionSleep, workerThread);
+    busy(50);
+    auto timeout = MakeDelegate(&CountReturnFunc, workerThread, std::chrono::milliseconds(5));
+    CountReturn retTimeout = timeout(data);
+    ASSERT_TRUE(!timeout.IsSuccess());
+    ASSERT_TRUE(retTimeout.data.empty());
+}
+
+static std::atomic<int> sharedInvokeCnt(0);
+static int SharedRetFunc(int value)
+{
+    // Periodically stall so queued calls from other callers time out
+    if (value % 8 == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    sharedInvokeCnt++;
+    return value + 1;
+}
+
+static void SharedInstanceTests()
+{
+    // Concurrent AsyncInvoke() callers sharing one instance each get their own result
+    auto shared = MakeDelegate(&SharedRetFunc, workerThread, std::chrono::milliseconds(1));
+    const int CALLERS = 4;
+    const int CALLS = 200;
+    sharedInvokeCnt = 0;
+    std::atomic<int> successCnt(0);
+    std::atomic<int> wrongCnt(0);
+    std::vector<std::thread> callers;
+    for (int c = 0; c < CALLERS; c++) {
+        callers.emplace_back([&shared, &successCnt, &wrongCnt, c]() {
+            for (int i = 0; i < CALLS; i++) {
+                int value = c * CALLS + i;
+                auto retVal = shared.AsyncInvoke(value);
+                if (retVal.has_value()) {
+                    successCnt++;
+                    if (*retVal != value + 1)
+                        wrongCnt++;
+                }
+            }
+        });
+    }
+    for (auto& caller : callers)
+        caller.join();
+    ASSERT_TRUE(wrongCnt == 0);
+    ASSERT_TRUE(successCnt == sharedInvokeCnt);
+}
+
+#if defined(_MSVC_LANG) && _MSVC_LANG >= 202002L || __cplusplus >= 202002L
+namespace AsyncWait
+{
+    // A minimal fire and forget coroutine return type
+    struct AwaitTask
+    {
+        struct promise_type
+        {
+            AwaitTask get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    static WorkerThread awaitThread("DelegateAwait_UT");
+    static std::atomic<int> awaitDone(0);
+
+    static std::string AwaitStr(const std::string& str, int& outCnt)
+    {
+        ASSERT_TRUE(WorkerThread::GetCurrentWorkerThread() == &workerThread);
+        outCnt++;
+        return str + "!";
+    }
+
+    static AwaitTask AwaitCoroutine()
+    {
+        ASSERT_TRUE(DelegateThread::GetCurrent() == &awaitThread);
+
+        // Resume on the caller thread with the return value
+        int outCnt = 0;
+        auto strDel = MakeDelegate(&AwaitStr, workerThread, WAIT_INFINITE);
+        std::string ret = co_await AsyncAwait(strDel, "test", outCnt);
+        ASSERT_TRUE(ret == "test!");
+        ASSERT_TRUE(outCnt == 1);
+        ASSERT_TRUE(DelegateThread::GetCurrent() == &awaitThread);
+
+        // Void return value and a non-blocking delegate
+        TestClass1 testClass1;
+        auto voidDel = MakeDelegate(&testClass1, &TestClass1::MemberFuncInt1, workerThread);
+        co_await AsyncAwait(voidDel, TEST_INT);
+        ASSERT_TRUE(DelegateThread::GetCurrent() == &awaitThread);
+
+        // Resume on the destination thread
+        co_await AsyncAwaitOn(&workerThread, strDel, std::string("a"), outCnt);
+        ASSERT_TRUE(DelegateThread::GetCurrent() == &workerThread);
+        ASSERT_TRUE(outCnt == 2);
+
+        // Empty delegate does not suspend
+        DelegateFreeAsyncWait<int(int)> empty;
+        ASSERT_TRUE(co_await AsyncAwait(empty, TEST_INT) == 0);
+
+        awaitDone++;
+    }
+
+    static void StartAwaitCoroutine()
+    {
+        AwaitCoroutine();
+    }
+}
+
+static void DelegateAwaitTests()
+{
+    awaitThread.CreateThread();
+    awaitDone = 0;
+    MakeDelegate(&StartAwaitCoroutine, awaitThread).AsyncInvoke();
+    while (awaitDone == 0)
+        std::this_thread::yield();
+    awaitThread.ExitThread();
+}
+#else
+static void DelegateAwaitTests() {}
+#endif
+
 void DelegateAsyncWait_UT()
 {
     workerThread.CreateThread();
@@ -668,6 +910,10 @@ void DelegateAsyncWait_UT()
     DelegateMemberAsyncWaitTests();
     DelegateMemberSpAsyncWaitTests();
     DelegateFunctionAsyncWaitTests();
+    CompletionTests();
+    RetValSlotTests();
+    SharedInstanceTests();
+    DelegateAwaitTests();
 
     workerThread.ExitThread();
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include <iostream>
 #include <set>
 #include <cstring>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <string>
+#include <vector>
 #include "WorkerThreadStd.h"
 
 using namespace DelegateLib;
@@ -165,6 +170,20 @@ static void DelegateFreeAsyncTests()
     cntDel(&classInstance);
     ASSERT_TRUE(Class::m_construtorCnt == 1);
 
+    // Reference, ptr and ptr-ptr arguments are bound to copies stored within the message
+    std::atomic<bool> argsCopied(false);
+    StructParam* psparam2 = &sparam;
+    std::function<void(const StructParam&, StructParam*, StructParam**)> argsFunc =
+        [&](const StructParam& r, StructParam* p, StructParam** pp) {
+            argsCopied = &r != &sparam && r.val == TEST_INT &&
+                p != nullptr && p != &sparam && p->val == TEST_INT &&
+                pp != &psparam2 && *pp != nullptr && *pp != &sparam && (*pp)->val == TEST_INT;
+        };
+    auto argsDel = MakeDelegate(argsFunc, workerThread);
+    argsDel(sparam, &sparam, &psparam2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    ASSERT_TRUE(argsCopied);
+
     // Compile error. Invalid to pass void* argument to async target function
 #if 0
     // Test void* args
@@ -528,6 +547,230 @@ static void DelegateFunctionAsyncTests()
     delete[] arr;
 }
 
+static void DelegateTypeIdTests()
+{
+    // Equality requires the most derived delegate types to match
+    DelegateFree<void(int)> syncDel(FreeFuncInt1);
+    DelegateFreeAsync<void(int)> asyncDel(FreeFuncInt1, workerThread);
+    ASSERT_TRUE(syncDel.GetTypeId() != asyncDel.GetTypeId());
+    ASSERT_TRUE(!syncDel.Equal(asyncDel));
+    ASSERT_TRUE(!asyncDel.Equal(syncDel));
+    ASSERT_TRUE(asyncDel.Equal(MakeDelegate(FreeFuncInt1, workerThread)));
+
+    MulticastDelegate<void(int)> container;
+    container += asyncDel;
+    container -= syncDel;
+    ASSERT_TRUE(container.Size() == 1);
+    container -= asyncDel;
+    ASSERT_TRUE(container.Empty());
+
+    // Message downcast without RTTI
+    using WaitMsgInt = DelegateAsyncWaitMsg<void, int>;
+    using WaitMsgFloat = DelegateAsyncWaitMsg<void, float>;
+    std::shared_ptr<DelegateMsg> msg = std::make_shared<WaitMsgInt>(nullptr, TEST_INT);
+    ASSERT_TRUE(DelegateMsgCast<WaitMsgInt>(msg) != nullptr);
+    ASSERT_TRUE(DelegateMsgCast<WaitMsgFloat>(msg) == nullptr);
+    ASSERT_TRUE(DelegateMsgCast<WaitMsgInt>(nullptr) == nullptr);
+}
+
+static void DelegateFutureTests()
+{
+    // Future completed by the destination thread
+    auto del = MakeDelegate(&FreeFuncIntWithReturn1, workerThread);
+    auto future = del.AsyncInvokeFuture(TEST_INT);
+    ASSERT_TRUE(future.IsValid());
+    auto retVal = future.Get();
+    ASSERT_TRUE(retVal.has_value());
+    ASSERT_TRUE(*retVal == TEST_INT);
+    ASSERT_TRUE(!future.IsValid());
+
+    // Void target function
+    TestClass1 testClass1;
+    auto memberDel = MakeDelegate(&testClass1, &TestClass1::MemberFuncInt1, workerThread);
+    auto voidRet = memberDel.AsyncInvokeFuture(TEST_INT).Get();
+    ASSERT_TRUE(voidRet.has_value() && *voidRet == true);
+
+    // Continuations run on the destination thread. Hold the destination thread 
+    // until the continuations are chained.
+    std::atomic<bool> onDestination(false);
+    std::atomic<bool> release(false);
+    auto holdDel = MakeDelegate(std::function<void()>([&release]() { 
+        while (!release) std::this_thread::yield(); }), workerThread);
+    holdDel();
+    auto funcDel = MakeDelegate(std::function<int(int)>([](int i) { return i + 1; }), workerThread);
+    auto chained = funcDel.AsyncInvokeFuture(TEST_INT)
+        .Then([&onDestination](int i) { 
+            onDestination = (WorkerThread::GetCurrentWorkerThread() == &workerThread);
+            return std::to_string(i); })
+        .Then([](std::string str) { return str.size(); });
+    ASSERT_TRUE(!chained.IsReady());
+    release = true;
+    auto chainedRet = chained.Get();
+    ASSERT_TRUE(chainedRet.has_value());
+    ASSERT_TRUE(*chainedRet == std::to_string(TEST_INT + 1).size());
+    ASSERT_TRUE(onDestination);
+
+    // Continuation on an already completed future runs immediately
+    auto ready = del.AsyncInvokeFuture(TEST_INT);
+    ASSERT_TRUE(ready.Wait());
+    ASSERT_TRUE(ready.IsReady());
+    int thenVal = 0;
+    ready.Then([&thenVal](int i) { thenVal = i; });
+    ASSERT_TRUE(thenVal == TEST_INT);
+
+    // Many requests in flight without blocking
+    std::vector<DelegateFuture<int>> futures;
+    for (int i = 0; i < 100; i++)
+        futures.push_back(del.AsyncInvokeFuture(TEST_INT));
+    for (auto& f : futures)
+        ASSERT_TRUE(f.Get() == TEST_INT);
+
+    // Empty delegate and unfulfilled promise complete without a value
+    DelegateFreeAsync<int(int)> empty;
+    auto emptyFuture = empty.AsyncInvokeFuture(TEST_INT);
+    ASSERT_TRUE(emptyFuture.IsReady());
+    ASSERT_TRUE(!emptyFuture.Then([](int i) { return i; }).Get().has_value());
+    {
+        DelegatePromise<int> promise;
+        future = promise.GetFuture();
+    }
+    ASSERT_TRUE(!future.Get().has_value());
+
+    // Timeout
+    DelegatePromise<int> pending;
+    auto pendingFuture = pending.GetFuture();
+    ASSERT_TRUE(!pendingFuture.Get(std::chrono::milliseconds(1)).has_value());
+    ASSERT_TRUE(pendingFuture.IsValid());
+    pending.SetValueFrom([]() { return TEST_INT; });
+    ASSERT_TRUE(pendingFuture.Get() == TEST_INT);
+}
+
+namespace Async
+{
+    static std::atomic<bool> coalesceHold(false);
+    static std::atomic<bool> coalesceStarted(false);
+    static std::vector<int> coalesceValues;
+    static std::vector<std::string> coalesceStrings;
+
+    static void CoalesceBlock()
+    {
+        coalesceStarted = true;
+        while (coalesceHold)
+            std::this_thread::yield();
+    }
+
+    static void CoalesceInt(int value) { coalesceValues.push_back(value); }
+    static void CoalesceOther(int value) { coalesceValues.push_back(-value); }
+    static void CoalesceString(const std::string* str) { coalesceStrings.push_back(*str); }
+
+    class CoalesceClass
+    {
+    public:
+        void Func(int value) { values.push_back(value); }
+        std::vector<int> values;
+    };
+
+    // Hold the worker thread so dispatched messages remain pending
+    static void CoalesceHold()
+    {
+        coalesceHold = true;
+        coalesceStarted = false;
+        MakeDelegate(&CoalesceBlock, workerThread).AsyncInvoke();
+        while (!coalesceStarted)
+            std::this_thread::yield();
+    }
+
+    // Release the worker thread and wait for the pending messages to be invoked
+    static void CoalesceRelease()
+    {
+        coalesceHold = false;
+        MakeDelegate(&CoalesceBlock, workerThread, WAIT_INFINITE).AsyncInvoke();
+    }
+}
+
+static void DelegateCoalesceTests()
+{
+    auto& table = workerThread.GetCoalesceTable();
+    coalesceValues.clear();
+
+    auto delegate = MakeDelegate(&CoalesceInt, workerThread);
+    ASSERT_TRUE(!delegate.IsCoalesce());
+    delegate.SetCoalesce(true);
+    ASSERT_TRUE(delegate.IsCoalesce());
+    auto copy = delegate;
+    ASSERT_TRUE(copy.IsCoalesce());
+
+    // A burst of calls invokes the target function once with the latest arguments
+    CoalesceHold();
+    for (int i = 1; i <= 10000; i++)
+        delegate(i);
+    {
+        std::lock_guard<std::mutex> lk(table.GetLock());
+        ASSERT_TRUE(table.Size() == 1);
+    }
+    ASSERT_TRUE(workerThread.GetQueueSize() == 1);
+    CoalesceRelease();
+    ASSERT_TRUE((coalesceValues == std::vector<int>{ 10000 }));
+
+    // A call after the pending message is invoked dispatches a new message
+    delegate(1);
+    CoalesceRelease();
+    ASSERT_TRUE((coalesceValues == std::vector<int>{ 10000, 1 }));
+
+    // Separate delegate instances bound to the same target share the pending message. 
+    // Other targets and non-coalescing delegates are not affected.
+    coalesceValues.clear();
+    CoalesceHold();
+    auto other = MakeDelegate(&CoalesceOther, workerThread);
+    other.SetCoalesce(true);
+    auto plain = MakeDelegate(&CoalesceInt, workerThread);
+    for (int i = 1; i <= 3; i++) {
+        auto instance = MakeDelegate(&CoalesceInt, workerThread);
+        instance.SetCoalesce(true);
+        instance(i);
+        other(i);
+        plain(100 + i);
+    }
+    CoalesceRelease();
+    ASSERT_TRUE((coalesceValues == std::vector<int>{ 3, -3, 101, 102, 103 }));
+
+    // Member function and pointer argument
+    CoalesceClass obj;
+    auto member = MakeDelegate(&obj, &CoalesceClass::Func, workerThread);
+    member.SetCoalesce(true);
+    auto strDelegate = MakeDelegate(&CoalesceString, workerThread);
+    strDelegate.SetCoalesce(true);
+    coalesceStrings.clear();
+    CoalesceHold();
+    for (int i = 0; i < 5; i++) {
+        member(i);
+        std::string str = std::to_string(i);
+        strDelegate(&str);
+    }
+    CoalesceRelease();
+    ASSERT_TRUE((obj.values == std::vector<int>{ 4 }));
+    ASSERT_TRUE((coalesceStrings == std::vector<std::string>{ "4" }));
+
+    // A pending message dropped by a full queue is removed from the pending table
+    coalesceValues.clear();
+    workerThread.SetMaxQueueSize(1, WorkerThread::FullPolicy::DROP_NEWEST);
+    CoalesceHold();
+    plain(1);
+    delegate(2);
+    delegate(3);
+    workerThread.SetMaxQueueSize(0);
+    {
+        std::lock_guard<std::mutex> lk(table.GetLock());
+        ASSERT_TRUE(table.Size() == 0);
+    }
+    delegate(4);
+    delegate(5);
+    CoalesceRelease();
+    ASSERT_TRUE((coalesceValues == std::vector<int>{ 1, 5 }));
+    std::lock_guard<std::mutex> lk(table.GetLock());
+    ASSERT_TRUE(table.Size() == 0);
+}
+
 void DelegateAsync_UT()
 {
     workerThread.CreateThread();
@@ -536,6 +779,9 @@ void DelegateAsync_UT()
     DelegateMemberAsyncTests();
     DelegateMemberSpAsyncTests();
     DelegateFunctionAsyncTests();
+    DelegateTypeIdTests();
+    DelegateFutureTests();
+    DelegateCoalesceTests();
 
     workerThread.ExitThread();
 }
\ No newline at end of file
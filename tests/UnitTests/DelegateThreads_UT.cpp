@@ -5,6 +5,9 @@
 #include <random>
 #include <chrono>
 #include <cstring>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
 
 using namespace DelegateLib;
 using namespace std;
@@ -278,6 +281,422 @@ static void FunctionTests()
     std::cout << "FunctionTests() complete!" << std::endl;
 }
 
+static void BatchTests()
+{
+    // Batches of messages are invoked in queue order
+    WorkerThread batchThread("DelegateThreadsBatch_UT");
+    batchThread.SetMaxBatchSize(4);
+    batchThread.CreateThread();
+
+    std::vector<int> values;
+    std::function<void(int)> func = [&values](int value) { values.push_back(value); };
+    auto delegate = MakeDelegate(func, batchThread);
+    for (int i = 0; i < 100; i++)
+        delegate(i);
+
+    // Exit message is invoked after all prior messages
+    batchThread.ExitThread();
+    ASSERT_TRUE(values.size() == 100);
+    for (int i = 0; i < 100; i++)
+        ASSERT_TRUE(values[i] == i);
+    ASSERT_TRUE(batchThread.GetDequeueLockCount() >= 100 / 4);
+
+    bool invalidBatch = false;
+    try
+    {
+        batchThread.SetMaxBatchSize(0);
+    }
+    catch (const std::invalid_argument&)
+    {
+        invalidBatch = true;
+    }
+    ASSERT_TRUE(invalidBatch);
+    std::cout << "BatchTests() complete!" << std::endl;
+}
+
+static void PriorityTests()
+{
+    WorkerThread priorityThread("DelegateThreadsPriority_UT");
+    priorityThread.CreateThread();
+
+    std::atomic<bool> hold[2] = { {true}, {true} };
+    std::atomic<bool> started[2] = { {false}, {false} };
+    std::vector<int> values;
+    std::function<void(int)> func = [&](int value) {
+        // Block the worker thread so messages accumulate in the queue
+        if (value < 0) {
+            started[-value - 1] = true;
+            while (hold[-value - 1])
+                std::this_thread::yield();
+        }
+        values.push_back(value);
+    };
+
+    // Delegate priority is copied and set by MakeDelegate()
+    auto low = MakeDelegate(func, priorityThread, DelegatePriority::LOW);
+    auto normal = MakeDelegate(func, priorityThread);
+    auto high = MakeDelegate(func, priorityThread, DelegatePriority::HIGH);
+    ASSERT_TRUE(low.GetPriority() == DelegatePriority::LOW);
+    ASSERT_TRUE(normal.GetPriority() == DelegatePriority::NORMAL);
+    ASSERT_TRUE(high.GetPriority() == DelegatePriority::HIGH);
+    auto highCopy = high;
+    ASSERT_TRUE(highCopy.GetPriority() == DelegatePriority::HIGH);
+    normal.SetPriority(DelegatePriority::LOW);
+    ASSERT_TRUE(normal.GetPriority() == DelegatePriority::LOW);
+    normal.SetPriority(DelegatePriority::NORMAL);
+
+    // Queued messages are invoked highest priority first, in dispatch order within a priority
+    normal(-1);
+    while (!started[0])
+        std::this_thread::yield();
+    for (int i = 0; i < 10; i++) {
+        low(i);
+        normal(100 + i);
+        high(200 + i);
+    }
+    hold[0] = false;
+
+    auto wait = MakeDelegate(func, priorityThread, WAIT_INFINITE, DelegatePriority::LOW);
+    ASSERT_TRUE(wait.GetPriority() == DelegatePriority::LOW);
+    wait(1000);
+    ASSERT_TRUE(wait.IsSuccess());
+    ASSERT_TRUE(values.size() == 32);
+    ASSERT_TRUE(values[0] == -1);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(values[1 + i] == 200 + i);
+        ASSERT_TRUE(values[11 + i] == 100 + i);
+        ASSERT_TRUE(values[21 + i] == i);
+    }
+    ASSERT_TRUE(values[31] == 1000);
+
+    // A higher priority message preempts the rest of a lower priority batch
+    values.clear();
+    hold[0] = true;
+    started[0] = false;
+    normal(-1);
+    while (!started[0])
+        std::this_thread::yield();
+    for (int i = 0; i < 10; i++)
+        low(i);
+    low(-2);
+    for (int i = 10; i < 20; i++)
+        low(i);
+    hold[0] = false;
+    while (!started[1])
+        std::this_thread::yield();
+    high(100);
+    hold[1] = false;
+    wait(1000);
+    ASSERT_TRUE(values.size() == 24);
+    ASSERT_TRUE(values[11] == -2);
+    ASSERT_TRUE(values[12] == 100);
+    for (int i = 10; i < 20; i++)
+        ASSERT_TRUE(values[3 + i] == i);
+    ASSERT_TRUE(values[23] == 1000);
+
+    priorityThread.ExitThread();
+    std::cout << "PriorityTests() complete!" << std::endl;
+}
+
+static std::vector<int> boundedValues;
+static std::atomic<bool> boundedHold(false);
+static std::atomic<bool> boundedStarted(false);
+
+static void BoundedBlock()
+{
+    boundedStarted = true;
+    while (boundedHold)
+        std::this_thread::yield();
+}
+
+static void BoundedFunc1(int value) { boundedValues.push_back(value); }
+static void BoundedFunc2(int value) { boundedValues.push_back(1000 + value); }
+static int BoundedWait(int value) { boundedValues.push_back(value); return value; }
+
+// Hold the worker thread so dispatched messages accumulate in the queue
+static void BoundedHold(WorkerThread& thread)
+{
+    boundedValues.clear();
+    boundedHold = true;
+    boundedStarted = false;
+    MakeDelegate(&BoundedBlock, thread).AsyncInvoke();
+    while (!boundedStarted)
+        std::this_thread::yield();
+}
+
+// Release the worker thread and wait until the queue is empty
+static void BoundedRelease(WorkerThread& thread)
+{
+    boundedHold = false;
+    MakeDelegate(&BoundedBlock, thread, WAIT_INFINITE).AsyncInvoke();
+}
+
+static void BoundedQueueTests()
+{
+    WorkerThread boundedThread("DelegateThreadsBounded_UT");
+    boundedThread.CreateThread();
+    ASSERT_TRUE(boundedThread.GetMaxQueueSize() == 0);
+    auto func1 = MakeDelegate(&BoundedFunc1, boundedThread);
+    auto func2 = MakeDelegate(&BoundedFunc2, boundedThread);
+
+    // Drop newest keeps the first queued messages
+    boundedThread.SetMaxQueueSize(4, WorkerThread::FullPolicy::DROP_NEWEST);
+    ASSERT_TRUE(boundedThread.GetMaxQueueSize() == 4);
+    BoundedHold(boundedThread);
+    for (int i = 0; i < 10; i++)
+        func1(i);
+    ASSERT_TRUE(boundedThread.GetQueueSize() == 4);
+    ASSERT_TRUE(boundedThread.GetHighWaterMark() == 4);
+    ASSERT_TRUE(boundedThread.GetDropCount() == 6);
+
+    // A blocking call dropped by a full queue returns as if the timeout expired
+    auto wait = MakeDelegate(&BoundedWait, boundedThread, WAIT_INFINITE);
+    ASSERT_TRUE(wait(99) == 0);
+    ASSERT_TRUE(wait.IsSuccess() == false);
+    ASSERT_TRUE(boundedThread.GetDropCount() == 7);
+    boundedThread.SetMaxQueueSize(0);
+    BoundedRelease(boundedThread);
+    ASSERT_TRUE((boundedValues == std::vector<int>{ 0, 1, 2, 3 }));
+
+    // Drop oldest keeps the last queued messages
+    boundedThread.SetMaxQueueSize(4, WorkerThread::FullPolicy::DROP_OLDEST);
+    BoundedHold(boundedThread);
+    for (int i = 0; i < 10; i++)
+        func1(i);
+    boundedThread.SetMaxQueueSize(0);
+    BoundedRelease(boundedThread);
+    ASSERT_TRUE((boundedValues == std::vector<int>{ 6, 7, 8, 9 }));
+
+    // Coalesce replaces the queued message bound to the same target function
+    boundedThread.SetMaxQueueSize(2, WorkerThread::FullPolicy::COALESCE);
+    BoundedHold(boundedThread);
+    func2(0);
+    func1(0);
+    for (int i = 1; i < 10; i++)
+        func1(i);
+    func2(1);
+    boundedThread.SetMaxQueueSize(0);
+    BoundedRelease(boundedThread);
+    ASSERT_TRUE((boundedValues == std::vector<int>{ 1001, 9 }));
+
+    // Fail throws to the producer
+    boundedThread.SetMaxQueueSize(1, WorkerThread::FullPolicy::FAIL);
+    BoundedHold(boundedThread);
+    func1(0);
+    bool overflow = false;
+    try
+    {
+        func1(1);
+    }
+    catch (const std::overflow_error&)
+    {
+        overflow = true;
+    }
+    ASSERT_TRUE(overflow);
+    boundedThread.SetMaxQueueSize(0);
+    BoundedRelease(boundedThread);
+    ASSERT_TRUE((boundedValues == std::vector<int>{ 0 }));
+
+    // Block holds the producer until the queue has space
+    boundedThread.SetMaxQueueSize(2, WorkerThread::FullPolicy::BLOCK);
+    BoundedHold(boundedThread);
+    std::atomic<int> produced(0);
+    std::thread producer([&]() {
+        for (int i = 0; i < 10; i++) {
+            func1(i);
+            produced++;
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(produced == 2);
+    ASSERT_TRUE(boundedThread.GetQueueSize() == 2);
+    boundedHold = false;
+    producer.join();
+    BoundedRelease(boundedThread);
+    ASSERT_TRUE(boundedValues.size() == 10);
+    for (int i = 0; i < 10; i++)
+        ASSERT_TRUE(boundedValues[i] == i);
+
+    // A blocking call does not block past its timeout on a full queue and is dropped
+    BoundedHold(boundedThread);
+    func1(0);
+    func1(1);
+    auto timed = MakeDelegate(&BoundedWait, boundedThread, std::chrono::milliseconds(20));
+    auto drops = boundedThread.GetDropCount();
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(timed(99) == 0);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(timed.IsSuccess() == false);
+    ASSERT_TRUE(elapsed >= std::chrono::milliseconds(20));
+    ASSERT_TRUE(elapsed < std::chrono::seconds(5));
+    ASSERT_TRUE(boundedThread.GetDropCount() == drops + 1);
+    BoundedRelease(boundedThread);
+    ASSERT_TRUE((boundedValues == std::vector<int>{ 0, 1 }));
+
+    // A blocked producer is released when the thread exits
+    BoundedHold(boundedThread);
+    func1(0);
+    func1(1);
+    std::thread blocked([&]() { func1(2); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    boundedHold = false;
+    boundedThread.ExitThread();
+    blocked.join();
+    std::cout << "BoundedQueueTests() complete!" << std::endl;
+}
+
+static std::atomic<bool> statsSynced(false);
+static void StatsSyncFunc() { statsSynced = true; }
+
+// Wait until the worker thread recorded the handler time of every message invoked 
+// so far. A blocking call returns before the worker records its own handler time.
+static void StatsSync(WorkerThread& thread)
+{
+    statsSynced = false;
+    MakeDelegate(&StatsSyncFunc, thread)();
+    while (!statsSynced)
+        std::this_thread::yield();
+}
+
+static void StatsTests()
+{
+    WorkerThread statsThread("DelegateThreadsStats_UT");
+    statsThread.CreateThread();
+    auto& stats = statsThread.GetStats();
+    ASSERT_TRUE(stats.IsEnabled() == false);
+    auto func1 = MakeDelegate(&BoundedFunc1, statsThread);
+    auto func2 = MakeDelegate(&BoundedFunc2, statsThread);
+
+    // Disabled instrumentation records nothing
+    BoundedHold(statsThread);
+    func1(0);
+    BoundedRelease(statsThread);
+    ASSERT_TRUE(stats.GetSnapshot().enqueueCount == 0);
+
+    stats.SetEnabled(true);
+    stats.SetTargetName(func1, "BoundedFunc1");
+    stats.SetTargetName(func2, "BoundedFunc2");
+
+    // Messages accumulate in the queue while the thread is held
+    BoundedHold(statsThread);
+    for (int i = 0; i < 5; i++)
+        func1(i);
+    for (int i = 0; i < 3; i++)
+        func2(i);
+    auto snapshot = stats.GetSnapshot();
+    ASSERT_TRUE(snapshot.queueDepth == 8);
+    ASSERT_TRUE(snapshot.maxQueueDepth == 8);
+    BoundedRelease(statsThread);
+
+    // Handler time of the release message is recorded after the caller is released
+    snapshot = stats.GetSnapshot();
+    while (snapshot.handlerTime.count < 10)
+    {
+        std::this_thread::yield();
+        snapshot = stats.GetSnapshot();
+    }
+    ASSERT_TRUE(snapshot.enqueueCount == 10);
+    ASSERT_TRUE(snapshot.dequeueCount == 10);
+    ASSERT_TRUE(snapshot.discardCount == 0);
+    ASSERT_TRUE(snapshot.queueDepth == 0);
+    ASSERT_TRUE(snapshot.maxQueueDepth >= 8);
+    ASSERT_TRUE(snapshot.queueWait.count == 10);
+    ASSERT_TRUE(snapshot.queueWait.maxNs > 0);
+    ASSERT_TRUE(snapshot.handlerTime.PercentileNs(1.0) == snapshot.handlerTime.maxNs);
+
+    int named = 0;
+    for (auto& target : snapshot.targets)
+    {
+        if (target.name == "BoundedFunc1")
+            ASSERT_TRUE(target.handlerTime.count == 5);
+        else if (target.name == "BoundedFunc2")
+            ASSERT_TRUE(target.handlerTime.count == 3);
+        else
+            continue;
+        named++;
+    }
+    ASSERT_TRUE(named == 2);
+
+    auto json = snapshot.ToJson();
+    ASSERT_TRUE(json.find("\"enqueueCount\":10") != std::string::npos);
+    ASSERT_TRUE(json.find("\"name\":\"BoundedFunc1\"") != std::string::npos);
+
+    // Messages dropped by a bounded queue are counted as discarded
+    stats.Reset();
+    statsThread.SetMaxQueueSize(2, WorkerThread::FullPolicy::DROP_NEWEST);
+    BoundedHold(statsThread);
+    for (int i = 0; i < 5; i++)
+        func1(i);
+    snapshot = stats.GetSnapshot();
+    ASSERT_TRUE(snapshot.discardCount == 3);
+    ASSERT_TRUE(snapshot.queueDepth == 2);
+    statsThread.SetMaxQueueSize(0);
+    BoundedRelease(statsThread);
+
+    // Targets beyond the lock-free lookup table are recorded. Sync first so the 
+    // release message handler time is not recorded after the reset.
+    struct StatsTarget { void Func(int) { } };
+    const std::size_t TARGETS = DelegateThreadStats::MAX_FAST_TARGETS + 16;
+    std::vector<StatsTarget> statsTargets(TARGETS);
+    StatsSync(statsThread);
+    stats.Reset();
+    for (int i = 0; i < 2; i++)
+    {
+        for (auto& target : statsTargets)
+            MakeDelegate(&target, &StatsTarget::Func, statsThread)(i);
+    }
+    StatsSync(statsThread);
+    snapshot = stats.GetSnapshot();
+    std::size_t recorded = 0;
+    for (std::size_t i = 0; i < TARGETS; i++)
+    {
+        std::size_t hash = MakeDelegate(&statsTargets[i], &StatsTarget::Func, statsThread).Hash();
+        auto target = std::find_if(snapshot.targets.begin(), snapshot.targets.end(),
+            [hash](const auto& t) { return t.hash == hash; });
+        std::uint64_t count = target != snapshot.targets.end() ? target->handlerTime.count : 0;
+        if (count != 2)
+            std::cout << "StatsTests() target " << i << " count " << count << std::endl;
+        else
+            recorded++;
+    }
+    ASSERT_TRUE(recorded == TARGETS);
+
+    statsThread.ExitThread();
+    std::cout << "StatsTests() complete!" << std::endl;
+}
+
+static void ExitThreadTests()
+{
+    WorkerThread exitThread("DelegateThreadsExit_UT");
+    exitThread.CreateThread();
+
+    // Each flood message dispatches another NORMAL message, so the queue never empties
+    std::atomic<int> floodCnt(0);
+    std::atomic<int> lowCnt(0);
+    DelegateFunctionAsync<void(int)>* floodPtr = nullptr;
+    std::function<void(int)> floodFunc = [&floodCnt, &floodPtr](int value) {
+        floodCnt++;
+        (*floodPtr)(value);
+    };
+    auto flood = MakeDelegate(floodFunc, exitThread);
+    floodPtr = &flood;
+    std::function<void(int)> lowFunc = [&lowCnt](int) { lowCnt++; };
+    auto low = MakeDelegate(lowFunc, exitThread, DelegatePriority::LOW);
+
+    for (int i = 0; i < 4; i++)
+        flood(i);
+    for (int i = 0; i < 10; i++)
+        low(i);
+    while (floodCnt < 100)
+        std::this_thread::yield();
+
+    // Messages queued before the call run and continuous NORMAL traffic does not delay the exit
+    exitThread.ExitThread();
+    ASSERT_TRUE(lowCnt == 10);
+    ASSERT_TRUE(exitThread.GetDropCount() >= 1);
+    std::cout << "ExitThreadTests() complete!" << std::endl;
+}
+
 void DelegateThreads_UT()
 {
     workerThread1.CreateThread();
@@ -287,6 +706,11 @@ void DelegateThreads_UT()
     MemberTests();
     MemberSpTests();
     FunctionTests();
+    BatchTests();
+    PriorityTests();
+    BoundedQueueTests();
+    StatsTests();
+    ExitThreadTests();
 
     workerThread1.ExitThread();
     workerThread2.ExitThread();
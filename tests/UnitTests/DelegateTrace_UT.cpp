@@ -0,0 +1,198 @@
+#include "DelegateLib.h"
+#include "UnitTestCommon.h"
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <functional>
+#include "WorkerThreadStd.h"
+
+using namespace DelegateLib;
+using namespace std;
+using namespace UnitTestData;
+
+static std::atomic<int> recvCnt(0);
+
+static void Recv(int) { recvCnt++; }
+static int RecvReturn(int value) { return value + 1; }
+
+// Wait until the destination thread writes the expected number of records
+static std::vector<DelegateTraceRecord> WaitForRecords(size_t cnt)
+{
+    auto records = DelegateTracer::GetInstance().GetRecords();
+    while (records.size() < cnt)
+    {
+        std::this_thread::yield();
+        records = DelegateTracer::GetInstance().GetRecords();
+    }
+    return records;
+}
+
+static void WaitForRecv(int cnt)
+{
+    while (recvCnt < cnt)
+        std::this_thread::yield();
+}
+
+static void DisabledTests(WorkerThread& thread)
+{
+    auto& tracer = DelegateTracer::GetInstance();
+    ASSERT_TRUE(tracer.GetSampleRate() == 0);
+    tracer.Clear();
+
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&Recv, thread);
+    for (int i = 0; i < 10; i++)
+        delegate(i);
+    WaitForRecv(10);
+    ASSERT_TRUE(tracer.GetRecords().empty());
+}
+
+static void SampleAllTests(WorkerThread& thread)
+{
+    auto& tracer = DelegateTracer::GetInstance();
+    tracer.Clear();
+    tracer.SetSampleRate(1);
+
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&Recv, thread);
+    tracer.SetTargetName(delegate, "Recv");
+    for (int i = 0; i < 10; i++)
+        delegate(i);
+    auto wait = MakeDelegate(&RecvReturn, thread, WAIT_INFINITE);
+    ASSERT_TRUE(wait(1) == 2);
+    tracer.SetSampleRate(0);
+
+    auto records = WaitForRecords(11);
+    ASSERT_TRUE(records.size() == 11);
+    for (auto& record : records)
+    {
+        ASSERT_TRUE(record.id != 0);
+        ASSERT_TRUE(record.tid != record.sourceTid);
+        ASSERT_TRUE(record.sendNs <= record.enqueueNs);
+        ASSERT_TRUE(record.enqueueNs <= record.dequeueNs);
+        ASSERT_TRUE(record.dequeueNs <= record.startNs);
+        ASSERT_TRUE(record.startNs <= record.endNs);
+    }
+    ASSERT_TRUE(records[0].hash == delegate.Hash());
+    ASSERT_TRUE(records[10].hash == wait.Hash());
+
+    auto json = tracer.ToChromeTrace();
+    ASSERT_TRUE(json.find("\"traceEvents\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"name\":\"DelegateTrace_UT\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"name\":\"Recv\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"ph\":\"f\"") != std::string::npos);
+}
+
+static void SampleRateTests(WorkerThread& thread)
+{
+    auto& tracer = DelegateTracer::GetInstance();
+    tracer.Clear();
+    tracer.SetSampleRate(4);
+
+    // A new source thread samples one of every four messages
+    recvCnt = 0;
+    std::thread source([&thread]() {
+        auto delegate = MakeDelegate(&Recv, thread);
+        for (int i = 0; i < 100; i++)
+            delegate(i);
+    });
+    source.join();
+    tracer.SetSampleRate(0);
+    WaitForRecv(100);
+    ASSERT_TRUE(WaitForRecords(25).size() == 25);
+}
+
+static void OverwriteTests()
+{
+    auto& tracer = DelegateTracer::GetInstance();
+    tracer.Clear();
+    tracer.SetBufferCapacity(8);
+    tracer.SetSampleRate(1);
+
+    // The destination thread keeps only the latest records
+    WorkerThread thread("DelegateTraceSmall_UT");
+    thread.CreateThread();
+    recvCnt = 0;
+    auto delegate = MakeDelegate(&Recv, thread);
+    for (int i = 0; i < 20; i++)
+        delegate(i);
+    WaitForRecv(20);
+    thread.ExitThread();
+    tracer.SetSampleRate(0);
+    tracer.SetBufferCapacity(DelegateTracer::DEFAULT_BUFFER_CAPACITY);
+
+    auto records = tracer.GetRecords();
+    ASSERT_TRUE(records.size() == 8);
+    for (size_t i = 1; i < records.size(); i++)
+        ASSERT_TRUE(records[i].id == records[i - 1].id + 1);
+
+    // The exited thread records remain readable until cleared
+    ASSERT_TRUE(tracer.GetRecords().size() == 8);
+    tracer.Clear();
+    ASSERT_TRUE(tracer.GetRecords().empty());
+}
+
+static void ExitedThreadTests(WorkerThread& thread)
+{
+    auto& tracer = DelegateTracer::GetInstance();
+    tracer.Clear();
+    tracer.SetSampleRate(1);
+
+    // Buffers of short lived source threads are freed, not accumulated
+    auto buffers = tracer.GetBufferCount();
+    recvCnt = 0;
+    for (int t = 0; t < 20; t++)
+    {
+        std::thread source([&thread]() {
+            MakeDelegate(&Recv, thread)(0);
+        });
+        source.join();
+    }
+    WaitForRecv(20);
+    tracer.SetSampleRate(0);
+    ASSERT_TRUE(WaitForRecords(20).size() == 20);
+    ASSERT_TRUE(tracer.GetBufferCount() == buffers + 20);
+
+    // Reading does not free buffers or discard records
+    ASSERT_TRUE(tracer.GetRecords().size() == 20);
+    ASSERT_TRUE(tracer.GetBufferCount() == buffers + 20);
+    tracer.Clear();
+    ASSERT_TRUE(tracer.GetBufferCount() == buffers);
+    ASSERT_TRUE(tracer.GetRecords().empty());
+
+    // The name of an exited source thread remains in every later export
+    WorkerThread producer("DelegateTraceSource_UT");
+    producer.CreateThread();
+    recvCnt = 0;
+    MakeDelegate(std::function<void()>([&thread]() {
+        DelegateTracer::GetInstance().SetSampleRate(1);
+        MakeDelegate(&Recv, thread)(0);
+        DelegateTracer::GetInstance().SetSampleRate(0);
+    }), producer, WAIT_INFINITE)();
+    producer.ExitThread();
+    WaitForRecv(1);
+    ASSERT_TRUE(WaitForRecords(1).size() == 1);
+    for (int i = 0; i < 2; i++)
+    {
+        auto json = tracer.ToChromeTrace();
+        ASSERT_TRUE(json.find("\"name\":\"DelegateTraceSource_UT\"") != std::string::npos);
+        ASSERT_TRUE(json.find("\"name\":\"DelegateTrace_UT\"") != std::string::npos);
+    }
+    tracer.Clear();
+}
+
+void DelegateTrace_UT()
+{
+    WorkerThread thread("DelegateTrace_UT");
+    thread.CreateThread();
+
+    DisabledTests(thread);
+    SampleAllTests(thread);
+    SampleRateTests(thread);
+    OverwriteTests();
+    ExitedThreadTests(thread);
+
+    thread.ExitThread();
+}
@@ -2577,6 +2577,11 @@ extern void DelegateAsync_UT();
 extern void DelegateAsyncWait_UT();
 extern void DelegateThreads_UT();
 extern void Containers_UT();
+extern void WorkerThreadLockFree_UT();
+extern void ThreadPool_UT();
+extern void Strand_UT();
+extern void DelegateTrace_UT();
+extern void Timer_UT();
 
 void DelegateUnitTests()
 {
@@ -2587,6 +2592,11 @@ void DelegateUnitTests()
 		DelegateAsync_UT();
 		DelegateAsyncWait_UT();
 		DelegateThreads_UT();
+		WorkerThreadLockFree_UT();
+		ThreadPool_UT();
+		Strand_UT();
+		DelegateTrace_UT();
+		Timer_UT();
 	}
 	catch (const std::exception& e)
 	{
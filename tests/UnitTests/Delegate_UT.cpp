@@ -651,10 +651,146 @@ static void DelegateFunctionTests()
     }
 }
 
+namespace Value
+{
+    static int sum = 0;
+    static void FreeAdd(int i) { sum += i; }
+    static void FreeSub(int i) { sum -= i; }
+
+    class Adder
+    {
+    public:
+        void Add(int i) { sum += i * m_scale; }
+        int Get() const { return m_scale; }
+        int m_scale = 1;
+    };
+}
+
+static void DelegateValueTests()
+{
+    using namespace Value;
+    using Del = DelegateValue<void(int)>;
+
+    // Delegate size allows inline storage within MulticastDelegateInline
+    static_assert(sizeof(Del) <= DEFAULT_INLINE_DELEGATE_SIZE, "DelegateValue too large");
+
+    Del empty;
+    ASSERT_TRUE(empty.Empty());
+    ASSERT_TRUE(empty == nullptr);
+    empty(TEST_INT);
+
+    // Free function
+    sum = 0;
+    Del delegate1(&FreeAdd);
+    delegate1(2);
+    ASSERT_TRUE(sum == 2);
+    ASSERT_TRUE(delegate1 == Del(&FreeAdd));
+    ASSERT_TRUE(!(delegate1 == Del(&FreeSub)));
+
+    // Member function bound to a raw object pointer
+    Adder adder;
+    adder.m_scale = 10;
+    Del delegate2(&adder, &Adder::Add);
+    delegate2(1);
+    ASSERT_TRUE(sum == 12);
+    ASSERT_TRUE(delegate2 == Del(&adder, &Adder::Add));
+    Adder adder2;
+    ASSERT_TRUE(!(delegate2 == Del(&adder2, &Adder::Add)));
+    ASSERT_TRUE(!(delegate1 == delegate2));
+
+    // Const member function and return value
+    DelegateValue<int()> delegate3(&adder, &Adder::Get);
+    ASSERT_TRUE(delegate3() == 10);
+    DelegateValue<int()> emptyRet;
+    ASSERT_TRUE(emptyRet() == 0);
+
+    // Small lambda
+    int count = 0;
+    auto lambda = [&count](int i) { count += i; };
+    Del delegate4 = lambda;
+    delegate4(3);
+    ASSERT_TRUE(count == 3);
+    ASSERT_TRUE(delegate4 == Del(lambda));
+
+    // Lambda with captured state copied with the delegate
+    DelegateValue<int(int)> delegate5 = [base = 100](int i) { return base + i; };
+    auto delegate6 = delegate5;
+    ASSERT_TRUE(delegate6(1) == 101);
+    ASSERT_TRUE(delegate5 == delegate6);
+
+    // Store delegates created using MakeDelegate
+    sum = 0;
+    Del delegate7 = MakeDelegate(&FreeAdd);
+    Del delegate8 = MakeDelegate(&adder, &Adder::Add);
+    Del delegate9 = MakeDelegate(std::function<void(int)>(FreeSub));
+    delegate7(1);
+    delegate8(1);
+    delegate9(5);
+    ASSERT_TRUE(sum == 6);
+    ASSERT_TRUE(delegate7 == delegate1);
+    ASSERT_TRUE(delegate8 == Del(MakeDelegate(&adder, &Adder::Add)));
+    ASSERT_TRUE(!(delegate8 == Del(MakeDelegate(&adder2, &Adder::Add))));
+
+    // Equality is symmetric and requires the exact delegate type
+    auto freeDelegate = MakeDelegate(&FreeAdd);
+    ASSERT_TRUE(!delegate7.Equal(freeDelegate));
+    ASSERT_TRUE(!freeDelegate.Equal(delegate7));
+    ASSERT_TRUE(delegate7.Equal(Del(freeDelegate)));
+    ASSERT_TRUE(Del(freeDelegate).Equal(delegate7));
+
+    // Copy, move and assignment
+    Del delegate10;
+    delegate10 = delegate2;
+    ASSERT_TRUE(delegate10 == delegate2);
+    Del delegate11 = std::move(delegate10);
+    ASSERT_TRUE(delegate11 == delegate2);
+    ASSERT_TRUE(delegate10.Empty());
+    delegate11 = std::move(delegate4);
+    ASSERT_TRUE(delegate11 == Del(lambda));
+    ASSERT_TRUE(!delegate4);
+    delegate11 = nullptr;
+    ASSERT_TRUE(delegate11.Empty());
+
+    // Clone and clone to caller storage
+    auto* delegate12 = delegate2.Clone();
+    ASSERT_TRUE(*delegate12 == delegate2);
+    delete delegate12;
+    alignas(std::max_align_t) unsigned char buffer[sizeof(Del)];
+    ASSERT_TRUE(delegate2.CloneTo(buffer, sizeof(buffer) - 1) == nullptr);
+    auto* delegate13 = delegate2.CloneTo(buffer, sizeof(buffer));
+    ASSERT_TRUE(delegate13 && *delegate13 == delegate2);
+    delegate13->~Del();
+
+    // Containers
+    sum = 0;
+    MulticastDelegateInline<void(int)> inlineContainer;
+    inlineContainer += Del(&FreeAdd);
+    inlineContainer += Del(&adder, &Adder::Add);
+    inlineContainer(1);
+    ASSERT_TRUE(sum == 11);
+    inlineContainer -= Del(&FreeAdd);
+    ASSERT_TRUE(inlineContainer.Size() == 1);
+    inlineContainer -= Del(&adder, &Adder::Add);
+    ASSERT_TRUE(inlineContainer.Empty());
+
+    MulticastDelegate<void(int)> container;
+    container += delegate7;
+    container += delegate8;
+    container -= delegate7;
+    ASSERT_TRUE(container.Size() == 1);
+
+    UnicastDelegate<void(int)> unicast;
+    unicast = Del(&FreeSub);
+    sum = 0;
+    unicast(1);
+    ASSERT_TRUE(sum == -1);
+}
+
 void Delegate_UT()
 {
     DelegateFreeTests();
     DelegateMemberTests();
     DelegateMemberSpTests();
     DelegateFunctionTests();
+    DelegateValueTests();
 }
\ No newline at end of file
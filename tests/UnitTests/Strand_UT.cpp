@@ -0,0 +1,151 @@
+#include "DelegateLib.h"
+#include "UnitTestCommon.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include "ThreadPool.h"
+#include "Strand.h"
+#include "WorkerThreadStd.h"
+
+using namespace DelegateLib;
+using namespace std;
+using namespace UnitTestData;
+
+static ThreadPool threadPool("Strand_UT", 4);
+
+static const int STRANDS = 1000;
+static const int PRODUCERS = 4;
+static const int LOOPS = 20;
+
+static std::atomic<int> recvCnt(0);
+
+// Wait for the strand pending count to reach zero. The count is decremented
+// after the last handler returns.
+static bool WaitForDrain(Strand& strand)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (strand.GetQueueSize() != 0)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+// An active object serialized by its own strand. State is not protected by a lock.
+class StrandObject
+{
+public:
+    StrandObject(DelegateThread& pool) : m_strand(pool) 
+    {
+        for (int i = 0; i < PRODUCERS; i++)
+            m_lastValue[i] = -1;
+    }
+
+    void Post(int producer, int value)
+    {
+        MakeDelegate(this, &StrandObject::Recv, m_strand).AsyncInvoke(producer, value);
+    }
+
+    Strand& GetStrand() { return m_strand; }
+
+    int m_cnt = 0;
+    bool m_ordered = true;
+    bool m_concurrent = false;
+    bool m_current = true;
+
+private:
+    void Recv(int producer, int value)
+    {
+        if (m_active++ != 0)
+            m_concurrent = true;
+        if (DelegateThread::GetCurrent() != &m_strand)
+            m_current = false;
+        if (value != m_lastValue[producer] + 1)
+            m_ordered = false;
+        m_lastValue[producer] = value;
+        m_cnt++;
+        m_active--;
+        recvCnt++;
+    }
+
+    Strand m_strand;
+    std::atomic<int> m_active{ 0 };
+    int m_lastValue[PRODUCERS];
+};
+
+static void ManyStrandsTests()
+{
+    recvCnt = 0;
+    std::vector<std::unique_ptr<StrandObject>> objects;
+    for (int i = 0; i < STRANDS; i++)
+        objects.push_back(std::unique_ptr<StrandObject>(new StrandObject(threadPool)));
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        producers.emplace_back([&objects, p]() {
+            for (int i = 0; i < LOOPS; i++)
+                for (auto& object : objects)
+                    object->Post(p, i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    while (recvCnt < STRANDS * PRODUCERS * LOOPS)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    for (auto& object : objects)
+    {
+        ASSERT_TRUE(WaitForDrain(object->GetStrand()));
+        ASSERT_TRUE(object->m_cnt == PRODUCERS * LOOPS);
+        ASSERT_TRUE(object->m_ordered);
+        ASSERT_TRUE(!object->m_concurrent);
+        ASSERT_TRUE(object->m_current);
+    }
+}
+
+static int RecvReturn(int value) { return value + 1; }
+
+static void BatchTests()
+{
+    // Strand reschedules itself after each message
+    recvCnt = 0;
+    Strand strand(threadPool, 1);
+    std::function<void(int)> func = [](int) { recvCnt++; };
+    auto delegate = MakeDelegate(func, strand);
+    for (int i = 0; i < 1000; i++)
+        delegate(i);
+    while (recvCnt < 1000)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_TRUE(WaitForDrain(strand));
+}
+
+static void WorkerThreadTests()
+{
+    // A strand borrowing a single WorkerThread
+    WorkerThread workerThread("StrandWorkerThread_UT");
+    workerThread.CreateThread();
+    {
+        Strand strand(workerThread);
+        auto delegate = MakeDelegate(&RecvReturn, strand, WAIT_INFINITE);
+        for (int i = 0; i < 100; i++)
+            ASSERT_TRUE(delegate(i) == i + 1);
+    }
+    workerThread.ExitThread();
+}
+
+void Strand_UT()
+{
+    threadPool.CreateThread();
+
+    ManyStrandsTests();
+    BatchTests();
+    WorkerThreadTests();
+
+    threadPool.ExitThread();
+}
@@ -0,0 +1,249 @@
+#include "DelegateLib.h"
+#include "UnitTestCommon.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <functional>
+#include "ThreadPool.h"
+
+using namespace DelegateLib;
+using namespace std;
+using namespace UnitTestData;
+
+static ThreadPool threadPool("ThreadPool_UT", 4);
+
+static const int PRODUCERS = 4;
+static const int LOOPS = 5000;
+
+static std::atomic<int> recvCnt(0);
+static int lastValue[PRODUCERS];
+static std::atomic<bool> ordered(true);
+static std::atomic<bool> concurrent(false);
+static std::atomic<int> active[PRODUCERS];
+
+static void RecvOrdered(int producer, int value)
+{
+    // Messages from each producer arrive in order, one at a time
+    if (active[producer]++ != 0)
+        concurrent = true;
+    if (value != lastValue[producer] + 1)
+        ordered = false;
+    lastValue[producer] = value;
+    active[producer]--;
+    recvCnt++;
+}
+
+static std::mutex threadsLock;
+static std::set<std::thread::id> threads;
+
+static void RecvAny(int)
+{
+    {
+        std::lock_guard<std::mutex> lk(threadsLock);
+        threads.insert(std::this_thread::get_id());
+    }
+    recvCnt++;
+}
+
+static int RecvReturn(int value) { return value + 1; }
+
+static void WaitForRecv(int cnt)
+{
+    while (recvCnt < cnt)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+static void UnorderedTests()
+{
+    recvCnt = 0;
+    threads.clear();
+    ASSERT_TRUE(threadPool.GetThreadCount() == 4);
+
+    auto delegate = MakeDelegate(&RecvAny, threadPool);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        producers.emplace_back([&delegate]() {
+            auto local = delegate;
+            for (int i = 0; i < LOOPS; i++)
+                local(i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    WaitForRecv(PRODUCERS * LOOPS);
+    ASSERT_TRUE(threadPool.GetQueueSize() == 0);
+
+    // Every invoke ran on a pool worker thread
+    std::lock_guard<std::mutex> lk(threadsLock);
+    ASSERT_TRUE(threads.size() >= 1 && threads.size() <= 4);
+    ASSERT_TRUE(threads.count(std::this_thread::get_id()) == 0);
+}
+
+static void OrderedTests()
+{
+    recvCnt = 0;
+    for (int i = 0; i < PRODUCERS; i++)
+    {
+        lastValue[i] = -1;
+        active[i] = 0;
+    }
+
+    auto delegate = MakeDelegate(&RecvOrdered, threadPool.GetOrdered());
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        producers.emplace_back([&delegate, p]() {
+            auto local = delegate;
+            for (int i = 0; i < LOOPS; i++)
+                local(p, i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    WaitForRecv(PRODUCERS * LOOPS);
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(!concurrent);
+}
+
+static void WorkStealingTests()
+{
+    ThreadPool pool("ThreadPoolSteal_UT", 2);
+    pool.CreateThread();
+
+    // The first message blocks worker 0. Worker 1 steals the messages queued 
+    // to worker 0 behind it.
+    std::atomic<bool> release(false);
+    std::atomic<int> cnt(0);
+    std::function<void()> block = [&release]() { 
+        while (!release) std::this_thread::yield(); };
+    std::function<void()> count = [&cnt]() { cnt++; };
+    MakeDelegate(block, pool)();
+    auto countDelegate = MakeDelegate(count, pool);
+    for (int i = 0; i < 100; i++)
+        countDelegate();
+
+    while (cnt < 100)
+        std::this_thread::yield();
+    ASSERT_TRUE(pool.GetStealCount() > 0);
+
+    release = true;
+    pool.ExitThread();
+}
+
+static void AsyncWaitTests()
+{
+    auto delegate = MakeDelegate(&RecvReturn, threadPool, WAIT_INFINITE);
+    for (int i = 0; i < 100; i++)
+        ASSERT_TRUE(delegate(i) == i + 1);
+
+    auto future = MakeDelegate(&RecvReturn, threadPool).AsyncInvokeFuture(1);
+    ASSERT_TRUE(future.Get() == 2);
+}
+
+static void ExitThreadTests()
+{
+    // Messages queued before exit are invoked
+    ThreadPool pool("ThreadPoolExit_UT", 3);
+    pool.CreateThread();
+
+    std::atomic<int> cnt(0);
+    std::function<void(int)> func = [&cnt](int) { cnt++; };
+    auto delegate = MakeDelegate(func, pool);
+    auto orderedDelegate = MakeDelegate(func, pool.GetOrdered());
+    for (int i = 0; i < 100; i++)
+    {
+        delegate(i);
+        orderedDelegate(i);
+    }
+    pool.ExitThread();
+    ASSERT_TRUE(cnt == 200);
+
+    // Messages dispatched while the pool exits are discarded, not stranded on an 
+    // exited worker. A blocked caller is released as if the timeout expired.
+    ThreadPool exitPool("ThreadPoolExiting_UT", 2);
+    exitPool.CreateThread();
+    std::atomic<bool> exiting(false);
+    std::atomic<int> invokeCnt(0);
+    std::atomic<int> waitFailCnt(0);
+    std::function<void(int)> recv = [&invokeCnt](int) { invokeCnt++; };
+    std::function<void()> block = [&]() {
+        while (!exiting)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // Dispatch from outside the pool to every worker while this worker keeps it alive
+        std::thread producer([&]() {
+            auto waitDelegate = MakeDelegate(recv, exitPool, WAIT_INFINITE);
+            auto orderedDelegate = MakeDelegate(recv, exitPool.GetOrdered());
+            for (int i = 0; i < 4; i++)
+            {
+                waitDelegate(i);
+                if (!waitDelegate.IsSuccess())
+                    waitFailCnt++;
+                orderedDelegate(i);
+            }
+        });
+        producer.join();
+    };
+    MakeDelegate(block, exitPool)();
+    exiting = true;
+    exitPool.ExitThread();
+    ASSERT_TRUE(waitFailCnt == 4);
+    ASSERT_TRUE(invokeCnt == 0);
+    ASSERT_TRUE(exitPool.GetQueueSize() == 0);
+}
+
+static void StatsTests()
+{
+    // Messages dispatched to every worker are recorded by the pool
+    ThreadPool pool("ThreadPoolStats_UT", 3);
+    pool.CreateThread();
+    pool.GetStats().SetEnabled(true);
+
+    std::atomic<int> cnt(0);
+    std::function<void(int)> func = [&cnt](int) { cnt++; };
+    auto delegate = MakeDelegate(func, pool);
+    auto orderedDelegate = MakeDelegate(func, pool.GetOrdered());
+    pool.GetStats().SetTargetName(delegate, "Func");
+    pool.GetStats().SetTargetName(orderedDelegate, "OrderedFunc");
+    for (int i = 0; i < 100; i++)
+    {
+        delegate(i);
+        orderedDelegate(i);
+    }
+    pool.ExitThread();
+    ASSERT_TRUE(cnt == 200);
+
+    auto snapshot = pool.GetStats().GetSnapshot();
+    ASSERT_TRUE(snapshot.enqueueCount == 200);
+    ASSERT_TRUE(snapshot.dequeueCount == 200);
+    ASSERT_TRUE(snapshot.queueDepth == 0);
+    ASSERT_TRUE(snapshot.queueWait.count == 200);
+    ASSERT_TRUE(snapshot.handlerTime.count == 200);
+    ASSERT_TRUE(snapshot.targets.size() == 2);
+    for (auto& target : snapshot.targets)
+    {
+        ASSERT_TRUE(target.name == "Func" || target.name == "OrderedFunc");
+        ASSERT_TRUE(target.handlerTime.count == 100);
+    }
+}
+
+void ThreadPool_UT()
+{
+    threadPool.CreateThread();
+
+    UnorderedTests();
+    OrderedTests();
+    WorkStealingTests();
+    AsyncWaitTests();
+    ExitThreadTests();
+    StatsTests();
+
+    threadPool.ExitThread();
+}
@@ -0,0 +1,197 @@
+#include "DelegateLib.h"
+#include "UnitTestCommon.h"
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <random>
+#include "Timer.h"
+#include "WorkerThreadStd.h"
+
+using namespace DelegateLib;
+using namespace std;
+using namespace UnitTestData;
+
+static WorkerThread workerThread("Timer_UT");
+
+static std::atomic<int> expiredCnt(0);
+static std::atomic<bool> expiredOnThread(true);
+
+static void ExpiredFunc()
+{
+    if (WorkerThread::GetCurrentWorkerThread() != &workerThread)
+        expiredOnThread = false;
+    expiredCnt++;
+}
+
+static void ExpiredTests()
+{
+    expiredCnt = 0;
+    Timer timer;
+    timer.Expired = MakeDelegate(&ExpiredFunc);
+    timer.Start(std::chrono::milliseconds(10), workerThread);
+    ASSERT_TRUE(timer.Enabled());
+
+    while (expiredCnt < 5)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    timer.Stop();
+    ASSERT_TRUE(!timer.Enabled());
+    ASSERT_TRUE(expiredOnThread);
+
+    // No callbacks after stop completes on the worker thread
+    auto sync = MakeDelegate(+[]() {}, workerThread, WAIT_INFINITE);
+    sync();
+    int cnt = expiredCnt;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(expiredCnt == cnt);
+}
+
+static void StartTests()
+{
+    // Start() without a thread must be called on a worker thread
+    Timer timer;
+    bool thrown = false;
+    try
+    {
+        timer.Start(std::chrono::milliseconds(10));
+    }
+    catch (const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+    ASSERT_TRUE(!timer.Enabled());
+
+    // Start() on the worker thread services the timer on that thread
+    expiredCnt = 0;
+    timer.Expired = MakeDelegate(&ExpiredFunc);
+    std::function<void(void)> func = [&timer]() { timer.Start(std::chrono::milliseconds(10)); };
+    auto start = MakeDelegate(func, workerThread, WAIT_INFINITE);
+    start();
+    while (expiredCnt < 2)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(expiredOnThread);
+}
+
+static void IdleTests()
+{
+    // An idle worker thread without timers is not woken
+    WorkerThread thread("TimerIdle_UT");
+    thread.CreateThread();
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    ASSERT_TRUE(thread.GetDequeueLockCount() == 0);
+
+    // Timer expirations do not post messages to the queue
+    std::atomic<int> cnt(0);
+    std::function<void(void)> func = [&cnt]() { cnt++; };
+    Timer timer;
+    timer.Expired = MakeDelegate(func);
+    timer.Start(std::chrono::milliseconds(10), thread);
+    while (cnt < 5)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(thread.GetDequeueLockCount() == 0);
+    timer.Stop();
+
+    thread.ExitThread();
+}
+
+static void MeasureTests()
+{
+    // Sub-millisecond period with expiration measurement
+    std::atomic<int> cnt(0);
+    std::function<void(void)> func = [&cnt]() { cnt++; };
+    Timer timer;
+    timer.Expired = MakeDelegate(func);
+    timer.SetMeasure(true);
+    timer.Start(std::chrono::microseconds(200), workerThread);
+    while (cnt < 20)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    timer.Stop();
+
+    TimerStats stats = timer.GetStats();
+    ASSERT_TRUE(stats.count >= 20);
+    ASSERT_TRUE(stats.minLate >= std::chrono::microseconds(0));
+    ASSERT_TRUE(stats.maxLate >= stats.minLate);
+    ASSERT_TRUE(stats.lastActual >= stats.lastScheduled);
+    ASSERT_TRUE(stats.jitter >= 0);
+
+    // Enabling again clears the results
+    timer.SetMeasure(true);
+    ASSERT_TRUE(timer.GetStats().count == 0);
+}
+
+struct WheelNode : public TimerWheelNode
+{
+    uint64_t expire = 0;
+    bool expired = false;
+};
+
+static void WheelTests()
+{
+    // Compare the wheel against the expected expirations while advancing
+    // by random steps, including steps spanning multiple levels
+    const uint64_t start = 0x123456789ULL;
+    TimerWheel wheel(start);
+    std::vector<WheelNode> nodes(1000);
+    std::mt19937_64 rng(1);
+
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        uint64_t delay = rng() % (uint64_t(1) << (6 * (i % 7)));
+        nodes[i].expire = start + delay;
+        wheel.Insert(&nodes[i], nodes[i].expire);
+    }
+
+    // Remove every 10th node
+    for (size_t i = 0; i < nodes.size(); i += 10)
+        wheel.Remove(&nodes[i]);
+
+    uint64_t now = start;
+    TimerWheelList expired;
+    bool correct = true;
+    while (wheel.NextTick() != UINT64_MAX)
+    {
+        uint64_t next = wheel.NextTick();
+        if (next < now)
+            correct = false;
+
+        // Advance to the next tick or by a random step
+        now = (rng() % 2) ? next : now + rng() % 5000;
+        wheel.Advance(now, expired);
+
+        while (TimerWheelNode* node = expired.PopFront())
+        {
+            WheelNode* n = static_cast<WheelNode*>(node);
+            if (n->expired || n->expire > now)
+                correct = false;
+            n->expired = true;
+        }
+
+        // No node expiring at or before now remains in the wheel
+        for (size_t i = 1; i < nodes.size(); i++)
+        {
+            if (i % 10 != 0 && !nodes[i].expired && nodes[i].expire <= now)
+                correct = false;
+        }
+    }
+    ASSERT_TRUE(correct);
+
+    for (size_t i = 0; i < nodes.size(); i++)
+        ASSERT_TRUE(nodes[i].expired == (i % 10 != 0));
+}
+
+void Timer_UT()
+{
+    WheelTests();
+
+    workerThread.CreateThread();
+
+    ExpiredTests();
+    StartTests();
+    MeasureTests();
+    IdleTests();
+
+    workerThread.ExitThread();
+}
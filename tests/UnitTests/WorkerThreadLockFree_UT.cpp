@@ -0,0 +1,95 @@
+#include "DelegateLib.h"
+#include "UnitTestCommon.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "WorkerThreadLockFree.h"
+
+using namespace DelegateLib;
+using namespace std;
+using namespace UnitTestData;
+
+static WorkerThreadLockFree workerThread("WorkerThreadLockFree_UT");
+
+static const int PRODUCERS = 4;
+static const int LOOPS = 10000;
+
+static std::atomic<int> recvCnt(0);
+static int lastValue[PRODUCERS];
+static bool ordered = true;
+
+static void RecvFunc(int producer, int value)
+{
+    // Messages from each producer arrive in order
+    if (value != lastValue[producer] + 1)
+        ordered = false;
+    lastValue[producer] = value;
+    recvCnt++;
+}
+
+static int RecvReturn(int value) { return value + 1; }
+
+static void MultipleProducerTests()
+{
+    recvCnt = 0;
+    for (int i = 0; i < PRODUCERS; i++)
+        lastValue[i] = -1;
+
+    auto delegate = MakeDelegate(&RecvFunc, workerThread);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++)
+    {
+        producers.emplace_back([&delegate, p]() {
+            auto local = delegate;
+            for (int i = 0; i < LOOPS; i++)
+                local(p, i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    while (recvCnt < PRODUCERS * LOOPS)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(workerThread.GetQueueSize() == 0);
+}
+
+static void AsyncWaitTests()
+{
+    // Worker thread sleeps between each call
+    auto delegate = MakeDelegate(&RecvReturn, workerThread, WAIT_INFINITE);
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(delegate(i) == i + 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+static void ExitThreadTests()
+{
+    // Messages queued before exit are invoked
+    WorkerThreadLockFree thread("WorkerThreadLockFreeExit_UT");
+    thread.CreateThread();
+
+    std::atomic<int> cnt(0);
+    std::function<void(int)> func = [&cnt](int) { cnt++; };
+    auto delegate = MakeDelegate(func, thread);
+    for (int i = 0; i < 100; i++)
+        delegate(i);
+    thread.ExitThread();
+    ASSERT_TRUE(cnt == 100);
+}
+
+void WorkerThreadLockFree_UT()
+{
+    workerThread.CreateThread();
+
+    MultipleProducerTests();
+    AsyncWaitTests();
+    ExitThreadTests();
+
+    workerThread.ExitThread();
+}